@@ -0,0 +1,390 @@
+#include "Arduino.h"
+#include "TFT_eSPI.h"
+
+#include <errno.h>
+#include <time.h>
+#include <malloc.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+/* OPTIONS */
+static HostOptions options = {
+    "data",     // fsRoot
+    0,          // frameLimit
+    NULL,       // dumpPath
+    128,        // panelWidth
+    128,        // panelHeight
+    320 * 1024, // heapSize
+    false,      // quiet
+    NULL,       // profilePath
+    0,          // spiHz
+    false,      // displayTask
+    false,      // engineSource
+    0,          // arenaSize
+    false,      // sharedVm
+    false,      // pool
+};
+
+HostOptions *hostOptions(void)
+{
+    return &options;
+}
+
+/* TIME */
+static uint64_t nowMicros()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000ULL) + ((uint64_t)ts.tv_nsec / 1000ULL);
+}
+
+static uint64_t startMicros = nowMicros();
+
+static bool isClockVirtual = false;
+static unsigned long virtualMillis = 0;
+
+unsigned long millis(void)
+{
+    if (isClockVirtual)
+    {
+        return virtualMillis;
+    }
+
+    return (unsigned long)((nowMicros() - startMicros) / 1000ULL);
+}
+
+unsigned long micros(void)
+{
+    return (unsigned long)(nowMicros() - startMicros);
+}
+
+void delay(unsigned long ms)
+{
+    if (isClockVirtual)
+    {
+        virtualMillis += ms;
+        return;
+    }
+
+    struct timespec ts;
+    ts.tv_sec = ms / 1000;
+    ts.tv_nsec = (ms % 1000) * 1000000L;
+    nanosleep(&ts, NULL);
+}
+
+void yield(void)
+{
+}
+
+/* RANDOM */
+static uint32_t randomState = 0x2545F491;
+
+void randomSeed(unsigned long seed)
+{
+    randomState = seed != 0 ? (uint32_t)seed : 0x2545F491;
+}
+
+long random(long max)
+{
+    if (max <= 0)
+    {
+        return 0;
+    }
+
+    // xorshift32: deterministic for a given seed, which replays rely on
+    randomState ^= randomState << 13;
+    randomState ^= randomState >> 17;
+    randomState ^= randomState << 5;
+
+    return (long)(randomState % (uint32_t)max);
+}
+
+long random(long min, long max)
+{
+    return min >= max ? min : min + random(max - min);
+}
+
+/* SERIAL */
+HardwareSerial Serial;
+
+void HardwareSerial::begin(unsigned long baud)
+{
+}
+
+void HardwareSerial::end()
+{
+}
+
+int HardwareSerial::available()
+{
+    return 0;
+}
+
+int HardwareSerial::read()
+{
+    return -1;
+}
+
+size_t HardwareSerial::print(const char *str)
+{
+    return this->printf("%s", str);
+}
+
+size_t HardwareSerial::print(int value)
+{
+    return this->printf("%d", value);
+}
+
+size_t HardwareSerial::println(const char *str)
+{
+    return this->printf("%s\n", str);
+}
+
+size_t HardwareSerial::println(int value)
+{
+    return this->printf("%d\n", value);
+}
+
+size_t HardwareSerial::printf(const char *format, ...)
+{
+    if (options.quiet)
+    {
+        return 0;
+    }
+
+    va_list args;
+    va_start(args, format);
+    int count = vprintf(format, args);
+    va_end(args);
+
+    return count > 0 ? count : 0;
+}
+
+void HardwareSerial::flush()
+{
+    fflush(stdout);
+}
+
+/* ESP */
+EspClass ESP;
+
+static uint32_t minFreeHeap = UINT32_MAX;
+
+void EspClass::restart()
+{
+    Serial.println("*** ESP.restart() on host: exiting");
+    hostQuit(1);
+}
+
+size_t hostHeapUsed(void)
+{
+    struct mallinfo2 info = mallinfo2();
+    return info.uordblks + info.hblkhd;
+}
+
+uint32_t EspClass::getHeapSize()
+{
+    return options.heapSize;
+}
+
+uint32_t EspClass::getFreeHeap()
+{
+    size_t used = hostHeapUsed();
+    uint32_t freeHeap = used < options.heapSize ? (uint32_t)(options.heapSize - used) : 0;
+
+    if (freeHeap < minFreeHeap)
+    {
+        minFreeHeap = freeHeap;
+    }
+
+    return freeHeap;
+}
+
+uint32_t EspClass::getMinFreeHeap()
+{
+    getFreeHeap();
+    return minFreeHeap;
+}
+
+uint32_t EspClass::getMaxAllocHeap()
+{
+    return getFreeHeap();
+}
+
+/* HOST */
+static long frameCount = 0;
+
+void hostClockSetVirtual(bool enabled)
+{
+    // always start from the same time: how long startup took must not shift the
+    // engine's timers between runs
+    if (enabled && !isClockVirtual)
+    {
+        virtualMillis = 0;
+    }
+
+    isClockVirtual = enabled;
+}
+
+void hostClockAdvance(unsigned long ms)
+{
+    virtualMillis += ms;
+}
+
+void hostSleepUntil(unsigned long ms)
+{
+    if (isClockVirtual)
+    {
+        virtualMillis = max(virtualMillis, ms);
+        return;
+    }
+
+    // millis() counts from startMicros on the monotonic clock, so the deadline is absolute
+    uint64_t deadline = startMicros + ((uint64_t)ms * 1000ULL);
+
+    struct timespec ts;
+    ts.tv_sec = (time_t)(deadline / 1000000ULL);
+    ts.tv_nsec = (long)((deadline % 1000000ULL) * 1000ULL);
+
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR)
+    {
+    }
+}
+
+void hostFrameEnd(void)
+{
+    frameCount++;
+
+    if (options.frameLimit > 0 && frameCount >= options.frameLimit)
+    {
+        hostQuit(0);
+    }
+}
+
+long hostFrameCount(void)
+{
+    return frameCount;
+}
+
+void hostQuit(int status)
+{
+    if (options.dumpPath != NULL)
+    {
+        if (!hostWritePanel(options.dumpPath))
+        {
+            fprintf(stderr, "Failed to write frame: %s\n", options.dumpPath);
+        }
+    }
+
+    fflush(stdout);
+    exit(status);
+}
+
+__attribute__((weak)) int hostMain(int argc, char **argv)
+{
+    return -1;
+}
+
+static void parseOptions(int argc, char **argv)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        const char *arg = argv[i];
+        const char *value = (i + 1 < argc) ? argv[i + 1] : NULL;
+
+        if (strcmp(arg, "--quiet") == 0)
+        {
+            options.quiet = true;
+        }
+        else if (strcmp(arg, "--display-task") == 0)
+        {
+            options.displayTask = true;
+        }
+        else if (strcmp(arg, "--engine-source") == 0)
+        {
+            options.engineSource = true;
+        }
+        else if (strcmp(arg, "--shared-vm") == 0)
+        {
+            options.sharedVm = true;
+        }
+        else if (strcmp(arg, "--pool") == 0)
+        {
+            options.pool = true;
+        }
+
+        if (value == NULL)
+        {
+            break;
+        }
+
+        if (strcmp(arg, "--fs") == 0)
+        {
+            options.fsRoot = value;
+            i++;
+        }
+        else if (strcmp(arg, "--frames") == 0)
+        {
+            options.frameLimit = atol(value);
+            i++;
+        }
+        else if (strcmp(arg, "--dump") == 0)
+        {
+            options.dumpPath = value;
+            i++;
+        }
+        else if (strcmp(arg, "--panel") == 0)
+        {
+            sscanf(value, "%dx%d", &options.panelWidth, &options.panelHeight);
+            i++;
+        }
+        else if (strcmp(arg, "--profile") == 0)
+        {
+            options.profilePath = value;
+            i++;
+        }
+        else if (strcmp(arg, "--spi-hz") == 0)
+        {
+            options.spiHz = (uint32_t)atol(value);
+            i++;
+        }
+        else if (strcmp(arg, "--heap") == 0)
+        {
+            options.heapSize = (uint32_t)atol(value);
+            i++;
+        }
+        else if (strcmp(arg, "--arena") == 0)
+        {
+            options.arenaSize = (uint32_t)atol(value);
+            i++;
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    // the ESP32's heap has no per-thread cache: with glibc's, freed blocks still count
+    // in hostHeapUsed() and a heap that was given back looks held, so run again without
+    if (getenv("GLIBC_TUNABLES") == NULL)
+    {
+        setenv("GLIBC_TUNABLES", "glibc.malloc.tcache_count=0", 1);
+        execv("/proc/self/exe", argv);
+    }
+
+    parseOptions(argc, argv);
+
+    int status = hostMain(argc, argv);
+    if (status >= 0)
+    {
+        hostQuit(status);
+    }
+
+    setup();
+
+    for (;;)
+    {
+        loop();
+    }
+
+    return 0;
+}
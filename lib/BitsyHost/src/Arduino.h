@@ -0,0 +1,118 @@
+#ifndef ARDUINO_H
+#define ARDUINO_H
+
+/*
+ * Host stand-in for the parts of the Arduino core that bitsybox uses.
+ * Only built for the `native` PlatformIO environment.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <math.h>
+#include <algorithm>
+
+// as in the ESP32 core
+using std::min;
+using std::max;
+
+#define IRAM_ATTR
+
+/* TIME */
+unsigned long millis(void);
+unsigned long micros(void);
+void delay(unsigned long ms);
+void yield(void);
+
+/* RANDOM */
+void randomSeed(unsigned long seed);
+long random(long max);
+long random(long min, long max);
+
+/* SERIAL */
+class HardwareSerial
+{
+public:
+    void begin(unsigned long baud);
+    void end();
+
+    int available();
+    int read();
+
+    size_t print(const char *str);
+    size_t print(int value);
+    size_t println(const char *str = "");
+    size_t println(int value);
+    size_t printf(const char *format, ...) __attribute__((format(printf, 2, 3)));
+
+    void flush();
+
+    operator bool() const { return true; }
+};
+
+extern HardwareSerial Serial;
+
+/* ESP */
+class EspClass
+{
+public:
+    void restart();
+
+    uint32_t getHeapSize();
+    uint32_t getFreeHeap();
+    uint32_t getMinFreeHeap();
+    uint32_t getMaxAllocHeap();
+};
+
+extern EspClass ESP;
+
+/* HOST */
+typedef struct HostOptions
+{
+    const char *fsRoot;    // directory that stands in for the LittleFS partition
+    long frameLimit;       // quit after this many frames (0 = run forever)
+    const char *dumpPath;  // write the last frame to this .ppm file on quit
+    int panelWidth;
+    int panelHeight;
+    uint32_t heapSize;     // notional DRAM size reported by ESP.getHeapSize()
+    bool quiet;            // drop Serial output
+    const char *profilePath; // write the frame profile to this file on exit
+    uint32_t spiHz;        // simulated panel bus clock for pixel transfers (0 = instant)
+    bool displayTask;      // present from a separate display task, as on the device
+    bool engineSource;     // compile the embedded engine source instead of loading its bytecode
+    uint32_t arenaSize;    // give the VM an arena of this many bytes (0 = the build's VM_ARENA_SIZE)
+    bool sharedVm;         // one VM for the boot menu and every game, as with VM_SHARED
+    bool pool;             // allocate the VM from the size-class pool, as with VM_POOL
+} HostOptions;
+
+HostOptions *hostOptions(void);
+
+// virtual clock: while enabled millis() only moves when advanced. micros() always
+// follows the real clock so per-frame timings stay meaningful.
+void hostClockSetVirtual(bool enabled);
+void hostClockAdvance(unsigned long ms);
+
+// sleep until millis() reaches ms: clock_nanosleep to the absolute deadline, or a jump
+// of the virtual clock
+void hostSleepUntil(unsigned long ms);
+
+// call once per presented frame; quits when the frame limit is reached
+void hostFrameEnd(void);
+long hostFrameCount(void);
+
+// bytes malloc has handed out, not capped by the notional heapSize like getFreeHeap();
+// exact, as main() turns glibc's thread cache off
+size_t hostHeapUsed(void);
+
+// flush host outputs and exit the process
+void hostQuit(int status);
+
+// optional entry point for host-only tools; return < 0 to fall through to setup()/loop()
+int hostMain(int argc, char **argv);
+
+void setup(void);
+void loop(void);
+
+#endif
@@ -0,0 +1,238 @@
+#include "FS.h"
+#include "LittleFS.h"
+
+#include <sys/stat.h>
+#include <dirent.h>
+#include <algorithm>
+#include <vector>
+
+namespace fs
+{
+
+class FileImpl
+{
+public:
+    FileImpl(const std::string &hostPath, const std::string &fsPath, const char *mode)
+        : _file(NULL), _isDirectory(false), _nextEntry(0), _fsPath(fsPath)
+    {
+        size_t slash = fsPath.find_last_of('/');
+        _name = (slash == std::string::npos) ? fsPath : fsPath.substr(slash + 1);
+
+        struct stat info;
+        if (stat(hostPath.c_str(), &info) == 0 && S_ISDIR(info.st_mode))
+        {
+            _isDirectory = true;
+            _hostPath = hostPath;
+
+            // LittleFS has its own ordering; sort so host runs are reproducible
+            DIR *dir = opendir(hostPath.c_str());
+            struct dirent *entry;
+            while (dir && (entry = readdir(dir)) != NULL)
+            {
+                if (strcmp(entry->d_name, ".") != 0 && strcmp(entry->d_name, "..") != 0)
+                {
+                    _entries.push_back(entry->d_name);
+                }
+            }
+            if (dir)
+            {
+                closedir(dir);
+            }
+            std::sort(_entries.begin(), _entries.end());
+        }
+        else
+        {
+            _file = fopen(hostPath.c_str(), (mode[0] == 'r') ? "rb" : (mode[0] == 'a') ? "ab" : "wb");
+        }
+    }
+
+    ~FileImpl()
+    {
+        close();
+    }
+
+    void close()
+    {
+        if (_file)
+        {
+            fclose(_file);
+            _file = NULL;
+        }
+    }
+
+    bool isOpen() const
+    {
+        return _file != NULL || _isDirectory;
+    }
+
+    FILE *_file;
+    bool _isDirectory;
+    std::vector<std::string> _entries;
+    size_t _nextEntry;
+    std::string _hostPath;
+    std::string _fsPath;
+    std::string _name;
+};
+
+/* File */
+File::File(FileImplPtr impl) : _impl(impl)
+{
+}
+
+size_t File::size()
+{
+    if (!_impl || !_impl->_file)
+    {
+        return 0;
+    }
+
+    long pos = ftell(_impl->_file);
+    fseek(_impl->_file, 0, SEEK_END);
+    long length = ftell(_impl->_file);
+    fseek(_impl->_file, pos, SEEK_SET);
+
+    return length > 0 ? (size_t)length : 0;
+}
+
+size_t File::readBytes(char *buffer, size_t length)
+{
+    if (!_impl || !_impl->_file)
+    {
+        return 0;
+    }
+
+    return fread(buffer, 1, length, _impl->_file);
+}
+
+int File::read()
+{
+    if (!_impl || !_impl->_file)
+    {
+        return -1;
+    }
+
+    int c = fgetc(_impl->_file);
+    return c == EOF ? -1 : c;
+}
+
+int File::available()
+{
+    return (int)(size() - position());
+}
+
+bool File::seek(uint32_t pos)
+{
+    return _impl && _impl->_file && fseek(_impl->_file, pos, SEEK_SET) == 0;
+}
+
+size_t File::position()
+{
+    return (_impl && _impl->_file) ? (size_t)ftell(_impl->_file) : 0;
+}
+
+void File::close()
+{
+    if (_impl)
+    {
+        _impl->close();
+    }
+}
+
+const char *File::name()
+{
+    return _impl ? _impl->_name.c_str() : "";
+}
+
+const char *File::path()
+{
+    return _impl ? _impl->_fsPath.c_str() : "";
+}
+
+bool File::isDirectory()
+{
+    return _impl && _impl->_isDirectory;
+}
+
+File File::openNextFile(const char *mode)
+{
+    if (!_impl || !_impl->_isDirectory || _impl->_nextEntry >= _impl->_entries.size())
+    {
+        return File();
+    }
+
+    const std::string &entry = _impl->_entries[_impl->_nextEntry++];
+    std::string fsPath = _impl->_fsPath + (_impl->_fsPath == "/" ? "" : "/") + entry;
+    FileImplPtr impl(new FileImpl(_impl->_hostPath + "/" + entry, fsPath, mode));
+
+    return impl->isOpen() ? File(impl) : File();
+}
+
+void File::rewindDirectory()
+{
+    if (_impl)
+    {
+        _impl->_nextEntry = 0;
+    }
+}
+
+File::operator bool() const
+{
+    return _impl && _impl->isOpen();
+}
+
+/* FS */
+FS::FS(const char *mountPoint) : _mountPoint(mountPoint), _mounted(false)
+{
+}
+
+std::string FS::hostPath(const char *path)
+{
+    std::string root = hostOptions()->fsRoot;
+
+    if (path[0] != '/')
+    {
+        root += "/";
+    }
+
+    return root + path;
+}
+
+File FS::open(const char *path, const char *mode, const bool create)
+{
+    if (!_mounted)
+    {
+        return File();
+    }
+
+    FileImplPtr impl(new FileImpl(hostPath(path), path, mode));
+
+    return impl->isOpen() ? File(impl) : File();
+}
+
+bool FS::exists(const char *path)
+{
+    struct stat info;
+    return _mounted && stat(hostPath(path).c_str(), &info) == 0;
+}
+
+/* LittleFS */
+LittleFSFS::LittleFSFS() : FS("/littlefs")
+{
+}
+
+bool LittleFSFS::begin(bool formatOnFail, const char *basePath, uint8_t maxOpenFiles, const char *partitionLabel)
+{
+    struct stat info;
+    _mounted = stat(hostOptions()->fsRoot, &info) == 0 && S_ISDIR(info.st_mode);
+
+    return _mounted;
+}
+
+void LittleFSFS::end()
+{
+    _mounted = false;
+}
+
+} // namespace fs
+
+fs::LittleFSFS LittleFS;
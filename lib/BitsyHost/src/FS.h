@@ -0,0 +1,64 @@
+#ifndef FS_H
+#define FS_H
+
+/*
+ * Host stand-in for the ESP32 core's fs::FS / fs::File, backed by a directory on
+ * the host (HostOptions::fsRoot). Paths are resolved relative to that directory.
+ */
+
+#include <Arduino.h>
+#include <memory>
+#include <string>
+
+namespace fs
+{
+
+class FileImpl;
+typedef std::shared_ptr<FileImpl> FileImplPtr;
+
+class File
+{
+public:
+    File(FileImplPtr impl = FileImplPtr());
+
+    size_t size();
+    size_t readBytes(char *buffer, size_t length);
+    int read();
+    int available();
+    bool seek(uint32_t pos);
+    size_t position();
+    void close();
+
+    const char *name();
+    const char *path();
+    bool isDirectory();
+    File openNextFile(const char *mode = "r");
+    void rewindDirectory();
+
+    operator bool() const;
+
+private:
+    FileImplPtr _impl;
+};
+
+class FS
+{
+public:
+    FS(const char *mountPoint);
+
+    File open(const char *path, const char *mode = "r", const bool create = false);
+    bool exists(const char *path);
+
+protected:
+    std::string hostPath(const char *path);
+
+    std::string _mountPoint;
+    bool _mounted;
+};
+
+} // namespace fs
+
+using fs::File;
+using fs::FS;
+
+#endif
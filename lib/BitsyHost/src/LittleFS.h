@@ -0,0 +1,22 @@
+#ifndef LITTLEFS_H
+#define LITTLEFS_H
+
+#include "FS.h"
+
+namespace fs
+{
+
+class LittleFSFS : public FS
+{
+public:
+    LittleFSFS();
+
+    bool begin(bool formatOnFail = false, const char *basePath = "/littlefs", uint8_t maxOpenFiles = 10, const char *partitionLabel = "spiffs");
+    void end();
+};
+
+} // namespace fs
+
+extern fs::LittleFSFS LittleFS;
+
+#endif
@@ -0,0 +1,468 @@
+#include "TFT_eSPI.h"
+
+#include <time.h>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+static TFT_eSPI *activePanel = NULL;
+
+static inline uint16_t swap16(uint16_t value)
+{
+    return (uint16_t)((value << 8) | (value >> 8));
+}
+
+// same 8-bit (RGB332) conversions as the real TFT_eSprite
+static inline uint8_t color565To332(uint32_t color)
+{
+    return (uint8_t)(((color & 0xE000) >> 8) | ((color & 0x0700) >> 6) | ((color & 0x0018) >> 3));
+}
+
+static inline uint16_t color332To565(uint8_t color)
+{
+    static const uint8_t blue[] = {0, 11, 21, 31};
+    uint8_t msb = (uint8_t)(((color & 0x1C) >> 2) | ((color & 0xC0) >> 3) | (color & 0xE0));
+    uint8_t lsb = (uint8_t)(((color & 0x1C) << 3) | blue[color & 0x03]);
+    return (uint16_t)((msb << 8) | lsb);
+}
+
+// time on the wire for 16-bit pixels at the simulated bus clock
+static void busSleep(uint32_t pixels)
+{
+    uint32_t hz = hostOptions()->spiHz;
+    if (hz == 0 || pixels == 0)
+    {
+        return;
+    }
+
+    uint64_t nanos = ((uint64_t)pixels * 16ULL * 1000000000ULL) / hz;
+
+    struct timespec ts;
+    ts.tv_sec = (time_t)(nanos / 1000000000ULL);
+    ts.tv_nsec = (long)(nanos % 1000000000ULL);
+    nanosleep(&ts, NULL);
+}
+
+struct TFT_eSPI::DmaState
+{
+    std::thread worker;
+    std::mutex mutex;
+    std::condition_variable changed;
+    bool isBusy;
+    bool isQuitting;
+
+    int32_t x, y, w, h;
+    const uint16_t *image;
+    bool swapBytes;
+};
+
+/* TFT_eSPI */
+TFT_eSPI::TFT_eSPI(int16_t w, int16_t h)
+    : _width(w), _height(h), textdatum(TL_DATUM), _swapBytes(false), _panel(NULL),
+      _winX(0), _winY(0), _winW(0), _winH(0), _winCursor(0), _writePixels(0), _dma(NULL)
+{
+}
+
+TFT_eSPI::~TFT_eSPI()
+{
+    deInitDMA();
+
+    if (activePanel == this)
+    {
+        activePanel = NULL;
+    }
+
+    free(_panel);
+}
+
+void TFT_eSPI::init(uint8_t tc)
+{
+    _width = hostOptions()->panelWidth;
+    _height = hostOptions()->panelHeight;
+
+    free(_panel);
+    _panel = (uint16_t *)calloc((size_t)_width * _height, sizeof(uint16_t));
+
+    activePanel = this;
+}
+
+void TFT_eSPI::setRotation(uint8_t r)
+{
+}
+
+uint16_t TFT_eSPI::color565(uint8_t r, uint8_t g, uint8_t b)
+{
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+}
+
+void TFT_eSPI::drawPixel(int32_t x, int32_t y, uint32_t color)
+{
+    if (_panel == NULL || x < 0 || y < 0 || x >= _width || y >= _height)
+    {
+        return;
+    }
+
+    _panel[(y * _width) + x] = (uint16_t)color;
+}
+
+void TFT_eSPI::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color)
+{
+    for (int32_t py = y; py < y + h; py++)
+    {
+        for (int32_t px = x; px < x + w; px++)
+        {
+            drawPixel(px, py, color);
+        }
+    }
+}
+
+uint16_t TFT_eSPI::readPixel(int32_t x, int32_t y)
+{
+    if (_panel == NULL || x < 0 || y < 0 || x >= _width || y >= _height)
+    {
+        return 0;
+    }
+
+    return _panel[(y * _width) + x];
+}
+
+void TFT_eSPI::fillScreen(uint32_t color)
+{
+    fillRect(0, 0, _width, _height, color);
+}
+
+void TFT_eSPI::startWrite(void)
+{
+    _writePixels = 0;
+}
+
+void TFT_eSPI::endWrite(void)
+{
+    busSleep(_writePixels);
+    _writePixels = 0;
+}
+
+void TFT_eSPI::setAddrWindow(int32_t x, int32_t y, int32_t w, int32_t h)
+{
+    _winX = x;
+    _winY = y;
+    _winW = w;
+    _winH = h;
+    _winCursor = 0;
+}
+
+void TFT_eSPI::pushPixels(const void *data, uint32_t len)
+{
+    const uint16_t *pixels = (const uint16_t *)data;
+
+    _writePixels += len;
+
+    for (uint32_t i = 0; i < len && _winW > 0; i++)
+    {
+        int32_t x = _winX + (_winCursor % _winW);
+        int32_t y = _winY + (_winCursor / _winW);
+
+        // without byte swapping the buffer is already in bus (big-endian) order
+        drawPixel(x, y, _swapBytes ? pixels[i] : swap16(pixels[i]));
+
+        _winCursor = (_winCursor + 1) % (_winW * _winH);
+    }
+}
+
+void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *data)
+{
+    for (int32_t py = 0; py < h; py++)
+    {
+        for (int32_t px = 0; px < w; px++)
+        {
+            // like pushPixels: without byte swapping the image is in bus order
+            uint16_t color = data[(py * w) + px];
+            drawPixel(x + px, y + py, _swapBytes ? color : swap16(color));
+        }
+    }
+}
+
+/* TFT_eSprite */
+TFT_eSprite::TFT_eSprite(TFT_eSPI *tft)
+    : TFT_eSPI(0, 0), _tft(tft), _img(NULL), _bpp(16), _created(false)
+{
+}
+
+TFT_eSprite::~TFT_eSprite(void)
+{
+    deleteSprite();
+}
+
+void *TFT_eSprite::createSprite(int16_t w, int16_t h, uint8_t frames)
+{
+    if (_created)
+    {
+        return _img;
+    }
+
+    if (w < 1 || h < 1)
+    {
+        return NULL;
+    }
+
+    _width = w;
+    _height = h;
+    _img = (uint8_t *)calloc((size_t)w * h, _bpp / 8);
+    _created = (_img != NULL);
+
+    return _img;
+}
+
+void TFT_eSprite::deleteSprite(void)
+{
+    free(_img);
+    _img = NULL;
+    _created = false;
+}
+
+void *TFT_eSprite::setColorDepth(int8_t b)
+{
+    _bpp = (b == 8) ? 8 : 16;
+
+    if (_created)
+    {
+        int16_t w = _width;
+        int16_t h = _height;
+        deleteSprite();
+        return createSprite(w, h);
+    }
+
+    return NULL;
+}
+
+void TFT_eSprite::drawPixel(int32_t x, int32_t y, uint32_t color)
+{
+    if (!_created || x < 0 || y < 0 || x >= _width || y >= _height)
+    {
+        return;
+    }
+
+    if (_bpp == 16)
+    {
+        ((uint16_t *)_img)[(y * _width) + x] = (uint16_t)color;
+    }
+    else
+    {
+        _img[(y * _width) + x] = color565To332(color);
+    }
+}
+
+void TFT_eSprite::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color)
+{
+    for (int32_t py = y; py < y + h; py++)
+    {
+        for (int32_t px = x; px < x + w; px++)
+        {
+            drawPixel(px, py, color);
+        }
+    }
+}
+
+uint16_t TFT_eSprite::readPixel(int32_t x, int32_t y)
+{
+    if (!_created || x < 0 || y < 0 || x >= _width || y >= _height)
+    {
+        return 0;
+    }
+
+    if (_bpp == 16)
+    {
+        return ((uint16_t *)_img)[(y * _width) + x];
+    }
+
+    return color332To565(_img[(y * _width) + x]);
+}
+
+void TFT_eSprite::fillSprite(uint32_t color)
+{
+    fillRect(0, 0, _width, _height, color);
+}
+
+void TFT_eSprite::pushSprite(int32_t x, int32_t y)
+{
+    if (!_created || _tft == NULL)
+    {
+        return;
+    }
+
+    for (int32_t py = 0; py < _height; py++)
+    {
+        for (int32_t px = 0; px < _width; px++)
+        {
+            _tft->drawPixel(x + px, y + py, readPixel(px, py));
+        }
+    }
+}
+
+bool TFT_eSprite::pushToSprite(TFT_eSprite *dspr, int32_t x, int32_t y)
+{
+    if (!_created || dspr == NULL || !dspr->created())
+    {
+        return false;
+    }
+
+    for (int32_t py = 0; py < _height; py++)
+    {
+        for (int32_t px = 0; px < _width; px++)
+        {
+            dspr->drawPixel(x + px, y + py, readPixel(px, py));
+        }
+    }
+
+    return true;
+}
+
+/* HOST */
+bool hostWritePanel(const char *path)
+{
+    if (activePanel == NULL || activePanel->panelBuffer() == NULL)
+    {
+        return false;
+    }
+
+    activePanel->dmaWait();
+
+    FILE *file = fopen(path, "wb");
+    if (!file)
+    {
+        return false;
+    }
+
+    int32_t w = activePanel->width();
+    int32_t h = activePanel->height();
+    uint16_t *panel = activePanel->panelBuffer();
+
+    fprintf(file, "P6\n%d %d\n255\n", (int)w, (int)h);
+
+    for (int32_t i = 0; i < w * h; i++)
+    {
+        uint16_t c = panel[i];
+        uint8_t rgb[3] = {
+            (uint8_t)(((c >> 11) & 0x1F) * 255 / 31),
+            (uint8_t)(((c >> 5) & 0x3F) * 255 / 63),
+            (uint8_t)((c & 0x1F) * 255 / 31),
+        };
+        fwrite(rgb, 1, 3, file);
+    }
+
+    fclose(file);
+    return true;
+}
+
+/* DMA */
+bool TFT_eSPI::initDMA(bool ctrl_cs)
+{
+    if (_dma != NULL)
+    {
+        return true;
+    }
+
+    _dma = new DmaState();
+    _dma->isBusy = false;
+    _dma->isQuitting = false;
+    _dma->worker = std::thread(&TFT_eSPI::dmaWorker, this);
+
+    return true;
+}
+
+void TFT_eSPI::deInitDMA(void)
+{
+    if (_dma == NULL)
+    {
+        return;
+    }
+
+    dmaWait();
+
+    {
+        std::lock_guard<std::mutex> lock(_dma->mutex);
+        _dma->isQuitting = true;
+    }
+    _dma->changed.notify_all();
+    _dma->worker.join();
+
+    delete _dma;
+    _dma = NULL;
+}
+
+void TFT_eSPI::pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *image, uint16_t *buffer)
+{
+    if (_dma == NULL || w <= 0 || h <= 0)
+    {
+        return;
+    }
+
+    dmaWait();
+
+    {
+        std::lock_guard<std::mutex> lock(_dma->mutex);
+        _dma->x = x;
+        _dma->y = y;
+        _dma->w = w;
+        _dma->h = h;
+        _dma->image = image;
+        _dma->swapBytes = _swapBytes;
+        _dma->isBusy = true;
+    }
+    _dma->changed.notify_all();
+}
+
+bool TFT_eSPI::dmaBusy(void)
+{
+    if (_dma == NULL)
+    {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(_dma->mutex);
+    return _dma->isBusy;
+}
+
+void TFT_eSPI::dmaWait(void)
+{
+    if (_dma == NULL)
+    {
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(_dma->mutex);
+    _dma->changed.wait(lock, [this]() { return !_dma->isBusy; });
+}
+
+void TFT_eSPI::dmaWorker(void)
+{
+    std::unique_lock<std::mutex> lock(_dma->mutex);
+
+    for (;;)
+    {
+        _dma->changed.wait(lock, [this]() { return _dma->isBusy || _dma->isQuitting; });
+
+        if (_dma->isQuitting)
+        {
+            return;
+        }
+
+        lock.unlock();
+
+        busSleep((uint32_t)(_dma->w * _dma->h));
+
+        for (int32_t py = 0; py < _dma->h; py++)
+        {
+            for (int32_t px = 0; px < _dma->w; px++)
+            {
+                // like pushPixels: without byte swapping the image is in bus order
+                uint16_t color = _dma->image[(py * _dma->w) + px];
+                drawPixel(_dma->x + px, _dma->y + py, _dma->swapBytes ? color : swap16(color));
+            }
+        }
+
+        lock.lock();
+        _dma->isBusy = false;
+        _dma->changed.notify_all();
+    }
+}
@@ -0,0 +1,122 @@
+#ifndef TFT_ESPI_H
+#define TFT_ESPI_H
+
+/*
+ * Headless stand-in for TFT_eSPI / TFT_eSprite. The "panel" is a 565 framebuffer
+ * in memory, sized from hostOptions() when init() is called. Only the subset of the
+ * API that bitsybox uses is provided, with the same names and semantics.
+ *
+ * DMA transfers run on a worker thread, one in flight at a time like the real
+ * driver. With --spi-hz set, pixel transfers (DMA or not) also take as long as they
+ * would on a bus of that speed, so overlap with the script update can be measured.
+ */
+
+#include <Arduino.h>
+
+#define TFT_WIDTH  128
+#define TFT_HEIGHT 128
+
+#define TL_DATUM 0
+#define TC_DATUM 1
+#define TR_DATUM 2
+
+#define TFT_BLACK 0x0000
+#define TFT_WHITE 0xFFFF
+#define TFT_RED   0xF800
+#define TFT_GREEN 0x07E0
+#define TFT_BLUE  0x001F
+
+class TFT_eSPI
+{
+public:
+    TFT_eSPI(int16_t w = TFT_WIDTH, int16_t h = TFT_HEIGHT);
+    virtual ~TFT_eSPI();
+
+    void init(uint8_t tc = 0);
+    void setRotation(uint8_t r);
+
+    int16_t width(void) { return _width; }
+    int16_t height(void) { return _height; }
+
+    void setTextDatum(uint8_t datum) { textdatum = datum; }
+
+    uint16_t color565(uint8_t red, uint8_t green, uint8_t blue);
+
+    virtual void drawPixel(int32_t x, int32_t y, uint32_t color);
+    virtual void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+    virtual uint16_t readPixel(int32_t x, int32_t y);
+    void fillScreen(uint32_t color);
+
+    // raw pixel streaming into a window, as used by sprites and pushImage()
+    void startWrite(void);
+    void endWrite(void);
+    void setAddrWindow(int32_t x, int32_t y, int32_t w, int32_t h);
+    void pushPixels(const void *data, uint32_t len);
+    void setSwapBytes(bool swap) { _swapBytes = swap; }
+    bool getSwapBytes(void) { return _swapBytes; }
+
+    void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *data);
+
+    // DMA: pushImageDMA() waits for the previous transfer, then returns while this
+    // one is sent. The image must stay untouched until dmaWait() / the next transfer.
+    bool initDMA(bool ctrl_cs = false);
+    void deInitDMA(void);
+    void pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *image, uint16_t *buffer = NULL);
+    bool dmaBusy(void);
+    void dmaWait(void);
+
+    // host only: the panel contents as native-endian 565 pixels
+    uint16_t *panelBuffer(void) { return _panel; }
+
+protected:
+    int32_t _width;
+    int32_t _height;
+    uint8_t textdatum;
+    bool _swapBytes;
+
+private:
+    uint16_t *_panel;
+
+    int32_t _winX, _winY, _winW, _winH;
+    int32_t _winCursor;
+
+    uint32_t _writePixels; // pixels sent since startWrite(), for --spi-hz
+
+    struct DmaState;
+    DmaState *_dma;
+    void dmaWorker(void);
+};
+
+class TFT_eSprite : public TFT_eSPI
+{
+public:
+    explicit TFT_eSprite(TFT_eSPI *tft);
+    ~TFT_eSprite(void);
+
+    void *createSprite(int16_t width, int16_t height, uint8_t frames = 1);
+    void deleteSprite(void);
+    bool created(void) { return _created; }
+    void *getPointer(void) { return _img; }
+
+    void *setColorDepth(int8_t b);
+    int8_t getColorDepth(void) { return _bpp; }
+
+    void drawPixel(int32_t x, int32_t y, uint32_t color);
+    void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+    uint16_t readPixel(int32_t x, int32_t y);
+    void fillSprite(uint32_t color);
+
+    void pushSprite(int32_t x, int32_t y);
+    bool pushToSprite(TFT_eSprite *dspr, int32_t x, int32_t y);
+
+private:
+    TFT_eSPI *_tft;
+    uint8_t *_img;
+    int8_t _bpp;
+    bool _created;
+};
+
+// host only: write the most recently initialised panel to a binary .ppm file
+bool hostWritePanel(const char *path);
+
+#endif
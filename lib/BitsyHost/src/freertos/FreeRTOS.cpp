@@ -0,0 +1,146 @@
+#include <Arduino.h>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+
+/* TASKS */
+struct HostTask
+{
+    std::thread thread;
+};
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t task, const char *name, uint32_t stackDepth, void *parameters,
+                                   UBaseType_t priority, TaskHandle_t *createdTask, BaseType_t coreId)
+{
+    // tasks never return in bitsybox, so the thread is left to run until exit
+    HostTask *hostTask = new HostTask();
+    hostTask->thread = std::thread(task, parameters);
+    hostTask->thread.detach();
+
+    if (createdTask != NULL)
+    {
+        *createdTask = hostTask;
+    }
+
+    return pdPASS;
+}
+
+TickType_t xTaskGetTickCount(void)
+{
+    return (TickType_t)millis();
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+    if (ticks == 0)
+    {
+        std::this_thread::yield();
+        return;
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(ticks));
+}
+
+void vTaskDelayUntil(TickType_t *previousWakeTime, TickType_t timeIncrement)
+{
+    TickType_t wakeTime = *previousWakeTime + timeIncrement;
+    int32_t remaining = (int32_t)(wakeTime - xTaskGetTickCount());
+
+    if (remaining > 0)
+    {
+        hostSleepUntil(wakeTime);
+    }
+
+    *previousWakeTime = wakeTime;
+}
+
+void taskYIELD(void)
+{
+    std::this_thread::yield();
+}
+
+/* QUEUES */
+struct HostQueue
+{
+    std::mutex mutex;
+    std::condition_variable changed;
+    std::deque<std::vector<uint8_t> > items;
+    UBaseType_t length;
+    UBaseType_t itemSize;
+};
+
+// wait on the queue's condition until ready() holds, or the timeout in ticks expires
+template <typename Ready>
+static bool waitFor(HostQueue *queue, std::unique_lock<std::mutex> &lock, TickType_t ticksToWait, Ready ready)
+{
+    if (ticksToWait == portMAX_DELAY)
+    {
+        queue->changed.wait(lock, ready);
+        return true;
+    }
+
+    return queue->changed.wait_for(lock, std::chrono::milliseconds(ticksToWait), ready);
+}
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize)
+{
+    HostQueue *queue = new HostQueue();
+    queue->length = length;
+    queue->itemSize = itemSize;
+
+    return queue;
+}
+
+void vQueueDelete(QueueHandle_t queue)
+{
+    delete queue;
+}
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void *item, TickType_t ticksToWait)
+{
+    std::unique_lock<std::mutex> lock(queue->mutex);
+
+    if (!waitFor(queue, lock, ticksToWait, [queue]() { return queue->items.size() < queue->length; }))
+    {
+        return pdFALSE; // errQUEUE_FULL
+    }
+
+    const uint8_t *bytes = (const uint8_t *)item;
+    queue->items.push_back(std::vector<uint8_t>(bytes, bytes + queue->itemSize));
+    queue->changed.notify_all();
+
+    return pdTRUE;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void *buffer, TickType_t ticksToWait)
+{
+    std::unique_lock<std::mutex> lock(queue->mutex);
+
+    if (!waitFor(queue, lock, ticksToWait, [queue]() { return !queue->items.empty(); }))
+    {
+        return pdFALSE;
+    }
+
+    memcpy(buffer, queue->items.front().data(), queue->itemSize);
+    queue->items.pop_front();
+    queue->changed.notify_all();
+
+    return pdTRUE;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue)
+{
+    std::lock_guard<std::mutex> lock(queue->mutex);
+    return (UBaseType_t)queue->items.size();
+}
+
+UBaseType_t uxQueueSpacesAvailable(QueueHandle_t queue)
+{
+    std::lock_guard<std::mutex> lock(queue->mutex);
+    return queue->length - (UBaseType_t)queue->items.size();
+}
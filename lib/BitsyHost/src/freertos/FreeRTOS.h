@@ -0,0 +1,28 @@
+#ifndef FREERTOS_H
+#define FREERTOS_H
+
+/*
+ * Host stand-in for the small part of ESP-IDF's FreeRTOS that bitsybox uses: tasks
+ * are std::threads (the core id is ignored, the host scheduler decides), queues are
+ * mutex/condition-variable ring buffers, and a tick is one millisecond (the ESP32
+ * Arduino default).
+ */
+
+#include <stdint.h>
+
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t TickType_t;
+
+#define pdFALSE 0
+#define pdTRUE 1
+#define pdPASS 1
+#define pdFAIL 0
+
+#define portMAX_DELAY ((TickType_t)0xFFFFFFFFUL)
+#define portTICK_PERIOD_MS 1
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+
+#define tskNO_AFFINITY 0x7FFFFFFF
+
+#endif
@@ -172,6 +172,25 @@ function reset_cur_game() {
 	}
 }
 
+// return the engine to how it was right after loading, so one VM can run the boot menu
+// and any number of games in turn. bitsybox restores top-level values and functions
+// from a snapshot of the globals; this rebuilds the objects, closures included.
+function resetEngine() {
+	clearGameData();
+	resetFlags();
+	roomTileIdCache = {};
+
+	bitsyResetColors();
+	renderer.ClearCache(); // releases the native tiles
+	renderer = new TileRenderer(tilesize);
+	transition = new TransitionManager();
+	dialogRenderer = dialogModule.CreateRenderer();
+	dialogBuffer = dialogModule.CreateBuffer();
+	fontManager = new FontManager();
+	scriptInterpreter = scriptModule.CreateInterpreter();
+	scriptUtils = scriptModule.CreateUtils();
+}
+
 function onready(startWithTitle) {
 	if (startWithTitle === undefined || startWithTitle === null) {
 		startWithTitle = true;
@@ -335,6 +354,7 @@ function updateInput() {
 
 var animationCounter = 0;
 var animationTime = 400;
+var animationGeneration = 0; // bumped whenever any animation frame changes
 function updateAnimation() {
 	animationCounter += deltaTime;
 
@@ -366,11 +386,14 @@ function updateAnimation() {
 
 		// reset counter
 		animationCounter = 0;
+		animationGeneration++;
 
 	}
 }
 
 function resetAllAnimations() {
+	animationGeneration++;
+
 	for (id in sprite) {
 		var spr = sprite[id];
 		if (spr.animation.isAnimated) {
@@ -1148,6 +1171,7 @@ function parseRoom(lines, i, compatibilityFlags) {
 	room[id] = {
 		id : id,
 		tilemap : [],
+		tilemapVersion : 0, // bumped on every write to tilemap, see setRoomTile()
 		walls : [],
 		exits : [],
 		endings : [],
@@ -1184,6 +1208,8 @@ function parseRoom(lines, i, compatibilityFlags) {
 		}
 	}
 
+	room[id].tilemapVersion++;
+
 	while (i < lines.length && lines[i].length > 0) { //look for empty line
 		// bitsyLog(getType(lines[i]));
 		if (getType(lines[i]) === "SPR") {
@@ -1207,7 +1233,7 @@ function parseRoom(lines, i, compatibilityFlags) {
 						var col = room[id].tilemap[row].indexOf( sprList[s] );
 						//if the sprite is in this row, replace it with the "null tile" and set its starting position
 						if (col != -1) {
-							room[id].tilemap[row][col] = "0";
+							setRoomTile(room[id], col, row, "0");
 							spriteStartLocations[ sprList[s] ] = {
 								room : id,
 								x : parseInt(col),
@@ -1680,32 +1706,12 @@ function drawRoom(room, frameIndex) { // frameIndex is optional
 		return;
 	}
 
-	// clear the screen buffer
+	//draw tiles over the background color (only the cells that changed or were drawn
+	// over since the last frame are touched, see bitsyDrawRoom)
 	bitsyDrawBegin(0);
-	bitsyClear(tileColorStartIndex);
+	bitsyDrawRoom(getRoomTileIds(room, frameIndex), tileColorStartIndex);
 	bitsyDrawEnd();
 
-	//draw tiles
-	for (i in room.tilemap) {
-		for (j in room.tilemap[i]) {
-			var id = room.tilemap[i][j];
-			var x = parseInt(j);
-			var y = parseInt(i);
-
-			if (id != "0") {
-				//bitsyLog(id);
-				if (tile[id] == null) { // hack-around to avoid corrupting files (not a solution though!)
-					id = "0";
-					room.tilemap[i][j] = id;
-				}
-				else {
-					// bitsyLog(id);
-					drawTile(getTileFrame(tile[id], frameIndex), x, y);
-				}
-			}
-		}
-	}
-
 	//draw items
 	for (var i = 0; i < room.items.length; i++) {
 		var itm = room.items[i];
@@ -1721,6 +1727,60 @@ function drawRoom(room, frameIndex) { // frameIndex is optional
 	}
 }
 
+// write one cell of a room's tilemap. code that edits room.tilemap in place some other
+// way must bump room.tilemapVersion itself, or the room keeps drawing the old tiles
+function setRoomTile(room, x, y, id) {
+	room.tilemap[y][x] = id;
+	room.tilemapVersion++;
+}
+
+// tile buffer id for every cell of a room (0 = empty), as drawn by bitsyDrawRoom().
+// only rebuilt when the render cache, the animation frame or the room's tilemap
+// (replaced, or edited as counted by tilemapVersion) changes
+var roomTileIdCache = {};
+
+function getRoomTileIds(room, frameIndex) {
+	var renderGeneration = renderer.GetCacheGeneration();
+	var cache = roomTileIdCache[room.id];
+
+	if (cache != undefined && cache.tilemap === room.tilemap && cache.tilemapVersion === room.tilemapVersion &&
+		cache.renderGeneration === renderGeneration &&
+		cache.animationGeneration === animationGeneration && cache.frameIndex === frameIndex) {
+		return cache.tileIds;
+	}
+
+	if (cache == undefined) {
+		cache = { tileIds: new Uint16Array(mapsize * mapsize) };
+		roomTileIdCache[room.id] = cache;
+	}
+
+	for (var y = 0; y < mapsize; y++) {
+		for (var x = 0; x < mapsize; x++) {
+			var id = room.tilemap[y][x];
+			var tileId = 0;
+
+			if (id != "0") {
+				if (tile[id] == null) { // hack-around to avoid corrupting files (not a solution though!)
+					setRoomTile(room, x, y, "0");
+				}
+				else {
+					tileId = getTileFrame(tile[id], frameIndex);
+				}
+			}
+
+			cache.tileIds[(y * mapsize) + x] = tileId;
+		}
+	}
+
+	cache.tilemap = room.tilemap;
+	cache.tilemapVersion = room.tilemapVersion; // after the hack-around above bumped it
+	cache.renderGeneration = renderGeneration;
+	cache.animationGeneration = animationGeneration;
+	cache.frameIndex = frameIndex;
+
+	return cache.tileIds;
+}
+
 // TODO : remove these get*Image methods
 function getTileFrame(t, frameIndex) {
 	return renderer.GetDrawingFrame(t, frameIndex);
@@ -26,6 +26,8 @@ var DialogRenderer = function() {
 	var font = null;
 	this.SetFont = function(f) {
 		font = f;
+		isGlyphTableStale = true; // re-upload glyphs for the new font
+		drawnPage = null; // the textbox buffer is recreated below
 		textboxInfo.height = (textboxInfo.padding_vert * 3) + (relativeFontHeight() * 2) + textboxInfo.arrow_height;
 
 		// todo : clean up all the scale stuff
@@ -82,6 +84,47 @@ var DialogRenderer = function() {
 		0,0,1,0,0
 	];
 
+	// native glyph table ids (see bitsyDrawGlyph), uploaded the first time a char is
+	// drawn. glyphs are 1-bit and take their color index when drawn, so only a new font
+	// (set on every game load, after the drawings are parsed) rebuilds the table: room
+	// changes and palette changes keep it
+	var glyphIds = {};
+	var isGlyphTableStale = true;
+
+	function resetGlyphs() {
+		bitsyResetGlyphs();
+		glyphIds = {};
+		isGlyphTableStale = false;
+	}
+
+	// one byte per 8 pixels of a row, leftmost pixel in the high bit
+	function packGlyph(bitmap, width, height) {
+		var stride = Math.ceil(width / 8);
+		var bits = new Uint8Array(stride * height);
+
+		for (var y = 0; y < height; y++) {
+			for (var x = 0; x < width; x++) {
+				if (bitmap[(y * width) + x] == 1) {
+					bits[(y * stride) + (x >> 3)] |= 0x80 >> (x & 7);
+				}
+			}
+		}
+
+		return bits;
+	}
+
+	// glyph id for a key, or -1 if the table is full (draw pixel by pixel instead)
+	function getGlyphId(key, bitmap, width, height) {
+		var glyphId = glyphIds[key];
+
+		if (glyphId === undefined) {
+			glyphId = bitsyAddGlyph(width, height, packGlyph(bitmap, width, height));
+			glyphIds[key] = glyphId;
+		}
+
+		return glyphId;
+	}
+
 	this.DrawNextArrow = function() {
 		// bitsyLog("draw arrow!");
 		bitsyDrawBegin(1);
@@ -92,6 +135,15 @@ var DialogRenderer = function() {
 			left = 4 * text_scale;
 		}
 
+		arrowRect = { x: left, y: top, w: 5 * text_scale, h: 3 * text_scale };
+
+		var arrowGlyphId = getGlyphId("arrow", scaledArrowData(), 5 * text_scale, 3 * text_scale);
+		if (arrowGlyphId >= 0) {
+			bitsyDrawGlyph(arrowGlyphId, left, top, textArrowIndex);
+			bitsyDrawEnd();
+			return;
+		}
+
 		for (var y = 0; y < 3; y++) {
 			for (var x = 0; x < 5; x++) {
 				var i = (y * 5) + x;
@@ -109,6 +161,18 @@ var DialogRenderer = function() {
 		bitsyDrawEnd();
 	};
 
+	function scaledArrowData() {
+		var bitmap = [];
+
+		for (var y = 0; y < 3 * text_scale; y++) {
+			for (var x = 0; x < 5 * text_scale; x++) {
+				bitmap.push(arrowdata[(Math.floor(y / text_scale) * 5) + Math.floor(x / text_scale)]);
+			}
+		}
+
+		return bitmap;
+	}
+
 	var text_scale = 2; //using a different scaling factor for text feels like cheating... but it looks better
 	this.DrawChar = function(char, row, col, leftPos) {
 		bitsyDrawBegin(1);
@@ -126,12 +190,24 @@ var DialogRenderer = function() {
 		var top = (4 * text_scale) + (row * 2 * text_scale) + (row * font.getHeight()) + Math.floor(char.offset.y);
 		var left = (4 * text_scale) + leftPos + Math.floor(char.offset.x);
 
-		for (var y = 0; y < char.height; y++) {
-			for (var x = 0; x < char.width; x++) {
-				var i = (y * char.width) + x;
-				if (charData[i] == 1) {
-					// todo : other colors
-					bitsyDrawPixel(char.color, left + x, top + y);
+		char.drawnRect = { x: left, y: top, w: char.width, h: char.height };
+
+		var glyphId = char.glyphId;
+		if (glyphId < 0 && char.glyphKey != null && char.width > 0 && char.height > 0) {
+			glyphId = getGlyphId(char.glyphKey, charData, char.width, char.height);
+		}
+
+		if (glyphId >= 0) {
+			bitsyDrawGlyph(glyphId, left, top, char.color);
+		}
+		else {
+			for (var y = 0; y < char.height; y++) {
+				for (var x = 0; x < char.width; x++) {
+					var i = (y * char.width) + x;
+					if (charData[i] == 1) {
+						// todo : other colors
+						bitsyDrawPixel(char.color, left + x, top + y);
+					}
 				}
 			}
 		}
@@ -143,15 +219,87 @@ var DialogRenderer = function() {
 	};
 
 	var effectTime = 0; // TODO this variable should live somewhere better
+
+	// the textbox keeps its pixels between frames: only newly revealed chars are drawn,
+	// animated chars are erased and redrawn, and static chars only when an erase hit them
+	var drawnPage = null;
+	var drawnRevealGeneration = -1;
+	var animatedCharCount = 0;
+	var arrowRect = null;
+
+	function overlapsAny(rect, rects) {
+		for (var i = 0; i < rects.length; i++) {
+			var other = rects[i];
+			if (rect.x < other.x + other.w && other.x < rect.x + rect.w &&
+				rect.y < other.y + other.h && other.y < rect.y + rect.h) {
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	this.UpdateTextbox = function(buffer) {
+		var canContinue = buffer.CanContinue();
+		var erased = [];
+
+		buffer.ForEachActiveChar(function(char) {
+			if (char.drawnRect != null && char.isAnimated) {
+				erased.push(char.drawnRect);
+			}
+		});
+
+		if (arrowRect != null && !canContinue) {
+			erased.push(arrowRect);
+			arrowRect = null;
+		}
+
+		bitsyDrawBegin(1);
+		for (var i = 0; i < erased.length; i++) {
+			bitsyClear(textBackgroundIndex, erased[i].x, erased[i].y, erased[i].w, erased[i].h);
+		}
+		bitsyDrawEnd();
+
+		var drawChar = this.DrawChar;
+		animatedCharCount = 0;
+
+		buffer.ForEachActiveChar(function(char, row, col, leftPos) {
+			if (char.drawnRect == null || char.isAnimated || overlapsAny(char.drawnRect, erased)) {
+				drawChar(char, row, col, leftPos);
+			}
+
+			if (char.isAnimated) {
+				animatedCharCount++;
+			}
+		});
+
+		if (canContinue && (arrowRect == null || overlapsAny(arrowRect, erased))) {
+			this.DrawNextArrow();
+		}
+	};
+
 	this.Draw = function(buffer, dt) {
 		effectTime += dt;
 
-		this.ClearTextbox();
+		if (isGlyphTableStale) {
+			resetGlyphs();
+		}
+
+		if (buffer.CurPage() !== drawnPage) {
+			this.ClearTextbox();
+			buffer.ForEachActiveChar(function(char) { char.drawnRect = null; });
+			drawnPage = buffer.CurPage();
+			drawnRevealGeneration = -1;
+			animatedCharCount = 0;
+			arrowRect = null;
+		}
 
-		buffer.ForEachActiveChar(this.DrawChar);
+		var isChanged = buffer.GetRevealGeneration() !== drawnRevealGeneration || animatedCharCount > 0 ||
+			buffer.CanContinue() !== (arrowRect != null);
 
-		if (buffer.CanContinue()) {
-			this.DrawNextArrow();
+		if (isChanged) {
+			drawnRevealGeneration = buffer.GetRevealGeneration();
+			this.UpdateTextbox(buffer);
 		}
 
 		this.DrawTextbox();
@@ -169,7 +317,7 @@ var DialogRenderer = function() {
 
 	this.Reset = function() {
 		effectTime = 0;
-		// TODO - anything else?
+		drawnPage = null; // start from a cleared textbox
 	}
 
 	// this.CharsPerRow = function() {
@@ -187,6 +335,7 @@ var DialogBuffer = function() {
 	var nextCharMaxTime = 50; // in milliseconds
 	var isDialogReadyToContinue = false;
 	var activeTextEffects = [];
+	var revealGeneration = 0; // changes whenever the visible chars do
 	var font = null;
 	var arabicHandler = new ArabicHandler();
 	var onDialogEndCallbacks = [];
@@ -201,6 +350,7 @@ var DialogBuffer = function() {
 	this.CurPageCount = function() { return buffer.length; };
 	this.CurRowCount = function() { return this.CurPage().length; };
 	this.CurCharCount = function() { return this.CurRow().length; };
+	this.GetRevealGeneration = function() { return revealGeneration; };
 
 	this.ForEachActiveChar = function(handler) { // Iterates over visible characters on the active page
 		var rowCount = rowIndex + 1;
@@ -239,6 +389,7 @@ var DialogBuffer = function() {
 		rowIndex = 0;
 		charIndex = 0;
 		isDialogReadyToContinue = false;
+		revealGeneration++;
 
 		afterManualPagebreak = false;
 
@@ -251,6 +402,7 @@ var DialogBuffer = function() {
 
 	this.DoNextChar = function() {
 		nextCharTimer = 0; //reset timer
+		revealGeneration++;
 
 		//time to update characters
 		if (charIndex + 1 < this.CurCharCount()) {
@@ -310,6 +462,7 @@ var DialogBuffer = function() {
 		}
 		rowIndex = this.CurRowCount()-1;
 		charIndex = this.CurCharCount()-1;
+		revealGeneration++;
 	};
 
 	this.FlipPage = function() {
@@ -318,6 +471,7 @@ var DialogBuffer = function() {
 		pageIndex++;
 		rowIndex = 0;
 		charIndex = 0;
+		revealGeneration++;
 	}
 
 	this.EndDialog = function() {
@@ -409,6 +563,10 @@ var DialogBuffer = function() {
 		}
 
 		this.bitmap = [];
+		this.glyphKey = null; // bitmaps with the same key are the same glyph
+		this.glyphId = -1; // set for chars of baked fonts, which need no upload
+		this.isAnimated = hasAnimatedEffect(this.effectList); // redrawn every frame
+		this.drawnRect = null; // where the renderer last drew it
 		this.width = 0;
 		this.height = 0;
 		this.base_offset = { // hacky name
@@ -423,6 +581,10 @@ var DialogBuffer = function() {
 
 		var charData = font.getChar(char);
 		this.bitmap = charData.data;
+		this.glyphKey = "char_" + char.charCodeAt(0);
+		if (charData.glyphId != undefined) {
+			this.glyphId = charData.glyphId;
+		}
 		this.width = charData.width;
 		this.height = charData.height;
 		this.base_offset.x = charData.offset.x;
@@ -441,6 +603,7 @@ var DialogBuffer = function() {
 		}
 
 		this.bitmap = drawingDataFlat;
+		this.glyphKey = "drw_" + drawingId;
 		this.width = 8;
 		this.height = 8;
 		this.spacing = 8;
@@ -874,6 +1037,25 @@ var ArabicHandler = function() {
 /* NEW TEXT EFFECTS */
 var TextEffects = {};
 
+// effects that only set a fixed color; anything else (wvy, shk, rbw, effects added by
+// hacks) may change every frame
+var staticTextEffects = {
+	"clr1" : true,
+	"clr2" : true,
+	"clr3" : true,
+	"_debug_highlight" : true,
+};
+
+function hasAnimatedEffect(effectList) {
+	for (var i = 0; i < effectList.length; i++) {
+		if (!staticTextEffects[effectList[i]]) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
 var RainbowEffect = function() {
 	this.DoEffect = function(char, time) {
 		char.color = rainbowColorStartIndex + Math.floor(((time / 100) - char.col * 0.5) % rainbowColorCount);
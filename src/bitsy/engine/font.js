@@ -46,6 +46,15 @@ this.Create = Create;
 
 this.Get = function(fontName) {
 	var fontData = self.GetData(fontName);
+
+	// fonts without data may be baked into the runtime instead of parsed
+	if (fontData == null) {
+		var bakedFont = bitsyGetBakedFont(fontName);
+		if (bakedFont != null) {
+			return new BakedFont(fontName, bakedFont);
+		}
+	}
+
 	return self.Create(fontData);
 }
 
@@ -216,4 +225,67 @@ function Font(fontData) {
 	parseFont(fontData);
 }
 
+// same interface as Font, backed by the runtime's baked tables: char data is fetched
+// on first use and has a glyphId (see bitsyDrawGlyph) in place of the bitmap array
+function BakedFont(fontName, bakedFont) {
+	var name = fontName;
+	var width = bakedFont.width;
+	var height = bakedFont.height;
+	var chardata = {};
+
+	var invalidCharData = {
+		width: width,
+		height: height,
+		offset: {
+			x: 0,
+			y: 0
+		},
+		spacing: width,
+		data: [],
+	};
+
+	for (var y = 0; y < height; y++) {
+		for (var x = 0; x < width; x++) {
+			invalidCharData.data.push((x < width-1 && y < height-1) ? 1 : 0);
+		}
+	}
+
+	function getCharData(codepoint) {
+		if (chardata[codepoint] === undefined) {
+			chardata[codepoint] = bitsyGetBakedChar(bakedFont.id, codepoint);
+		}
+
+		return chardata[codepoint];
+	}
+
+	this.getName = function() {
+		return name;
+	}
+
+	this.getData = function() {
+		return chardata;
+	}
+
+	this.getWidth = function() {
+		return width;
+	}
+
+	this.getHeight = function() {
+		return height;
+	}
+
+	this.hasChar = function(char) {
+		return getCharData(char.charCodeAt(0)) != null;
+	}
+
+	this.getChar = function(char) {
+		var charData = getCharData(char.charCodeAt(0));
+		return charData != null ? charData : invalidCharData;
+	}
+
+	this.allCharCodes = function() {
+		return bitsyGetBakedCharCodes(bakedFont.id);
+	}
+}
+
 } // FontManager
\ No newline at end of file
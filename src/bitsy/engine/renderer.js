@@ -8,6 +8,8 @@ var drawingCache = {
 	render: {},
 };
 
+var cacheGeneration = 0; // tile buffer ids are only valid within one generation
+
 // var debugRenderCount = 0;
 
 function createRenderCacheId(drawingId, colorIndex) {
@@ -42,24 +44,26 @@ function renderTileFromDrawingData(drawingData, col) {
 	var backgroundColor = tileColorStartIndex + 0;
 	var foregroundColor = tileColorStartIndex + col;
 
-	bitsyDrawBegin(tileId);
+	bitsyDrawTileData(tileId, packDrawingData(drawingData), foregroundColor, backgroundColor);
+
+	return tileId;
+}
+
+// one byte per row, leftmost pixel in the high bit (the layout bitsyDrawTileData expects)
+function packDrawingData(drawingData) {
+	var bits = new Uint8Array(tilesize);
 
 	for (var y = 0; y < tilesize; y++) {
+		var row = 0;
+
 		for (var x = 0; x < tilesize; x++) {
-			var px = drawingData[y][x];
-
-			if (px === 1) {
-				bitsyDrawPixel(foregroundColor, x, y);
-			}
-			else {
-				bitsyDrawPixel(backgroundColor, x, y);
-			}
+			row = (row << 1) | (drawingData[y][x] === 1 ? 1 : 0);
 		}
-	}
 
-	bitsyDrawEnd();
+		bits[y] = row;
+	}
 
-	return tileId;
+	return bits;
 }
 
 // TODO : move into core
@@ -122,6 +126,11 @@ this.GetFrameCount = function(drawingId) {
 this.ClearCache = function() {
 	bitsyResetTiles();
 	drawingCache.render = {};
+	cacheGeneration++;
+}
+
+this.GetCacheGeneration = function() {
+	return cacheGeneration;
 }
 
 } // Renderer()
\ No newline at end of file
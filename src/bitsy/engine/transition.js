@@ -4,9 +4,13 @@ var TransitionManager = function() {
 
 	var isTransitioning = false;
 	var transitionTime = 0; // milliseconds
-	var minStepTime = 125; // cap the frame rate
+	var minStepTime = 125; // length of one effect step (effects with a pixelEffectFunc draw once per step)
 	var curStep = 0;
 
+	// native room snapshot handles (see bitsySnapshotRoom)
+	var startSnapshot = 0;
+	var endSnapshot = 1;
+
 	this.BeginTransition = function(startRoom, startX, startY, endRoom, endX, endY, effectName) {
 		bitsyLog("--- START ROOM TRANSITION ---");
 
@@ -25,9 +29,8 @@ var TransitionManager = function() {
 			player().room = "_transition_none"; // kind of hacky!!
 		}
 
-		var startRoomPixels = createRoomPixelBuffer(room[startRoom]);
+		var startImage = createRoomSnapshot(startSnapshot, room[startRoom]);
 		var startPalette = getPal(room[startRoom].pal);
-		var startImage = new PostProcessImage(startRoomPixels);
 		transitionStart = new TransitionInfo(startImage, startPalette, startX, startY);
 
 		if (transitionEffects[curEffect].showPlayerEnd) {
@@ -39,9 +42,8 @@ var TransitionManager = function() {
 			player().room = "_transition_none";
 		}
 
-		var endRoomPixels = createRoomPixelBuffer(room[endRoom]);
+		var endImage = createRoomSnapshot(endSnapshot, room[endRoom]);
 		var endPalette = getPal(room[endRoom].pal);
-		var endImage = new PostProcessImage(endRoomPixels);
 		transitionEnd = new TransitionInfo(endImage, endPalette, endX, endY);
 
 		isTransitioning = true;
@@ -63,23 +65,49 @@ var TransitionManager = function() {
 
 		transitionTime += dt;
 
-		var maxStep = transitionEffects[curEffect].stepCount;
+		var effect = transitionEffects[curEffect];
+		var maxStep = effect.stepCount;
+
+		if (!effect.pixelEffectFunc) {
+			// native kernels are cheap enough to draw every frame: delta follows the clock
+			// (over the same length as the stepped version) instead of jumping per step
+			var delta = Math.min(transitionTime / (maxStep * minStepTime), (maxStep - 1) / maxStep);
 
-		if (transitionTime >= minStepTime) {
+			if (effect.paletteEffectFunc) {
+				updatePaletteWithTileColors(effect.paletteEffectFunc(transitionStart, transitionEnd, delta));
+			}
+
+			bitsyDrawBegin(0);
+			bitsyDrawTransition(
+				curEffect,
+				delta,
+				transitionStart.Image.Snapshot,
+				transitionStart.PlayerCenter.x,
+				transitionStart.PlayerCenter.y,
+				transitionEnd.Image.Snapshot,
+				transitionEnd.PlayerCenter.x,
+				transitionEnd.PlayerCenter.y);
+			bitsyDrawEnd();
+
+			if (transitionTime >= (maxStep - 1) * minStepTime) {
+				curStep = maxStep - 1;
+			}
+		}
+		else if (transitionTime >= minStepTime) {
 			curStep++;
 
 			var step = curStep;
 			bitsyLog("transition step " + step);
 
-			if (transitionEffects[curEffect].paletteEffectFunc) {
-				var colors = transitionEffects[curEffect].paletteEffectFunc(transitionStart, transitionEnd, (step / maxStep));
+			if (effect.paletteEffectFunc) {
+				var colors = effect.paletteEffectFunc(transitionStart, transitionEnd, (step / maxStep));
 				updatePaletteWithTileColors(colors);
 			}
 
 			bitsyDrawBegin(0);
 			for (var y = 0; y < 128; y++) {
 				for (var x = 0; x < 128; x++) {
-					var color = transitionEffects[curEffect].pixelEffectFunc(transitionStart, transitionEnd, x, y, (step / maxStep));
+					var color = effect.pixelEffectFunc(transitionStart, transitionEnd, x, y, (step / maxStep));
 					bitsyDrawPixel(color, x, y);
 				}
 			}
@@ -95,6 +123,9 @@ var TransitionManager = function() {
 			transitionEnd = null;
 			curStep = 0;
 
+			bitsyReleaseSnapshot(startSnapshot);
+			bitsyReleaseSnapshot(endSnapshot);
+
 			if (transitionCompleteCallback != null) {
 				transitionCompleteCallback();
 			}
@@ -114,6 +145,8 @@ var TransitionManager = function() {
 		}
 	}
 
+	// effects without a pixelEffectFunc are drawn by the native kernel of the same
+	// name (see bitsyDrawTransition)
 	var transitionEffects = {};
 	var curEffect = "none";
 	this.RegisterTransitionEffect = function(name, effect) {
@@ -131,9 +164,6 @@ var TransitionManager = function() {
 		showPlayerStart : false,
 		showPlayerEnd : true,
 		stepCount : 6,
-		pixelEffectFunc : function(start, end, pixelX, pixelY, delta) {
-			return delta < 0.5 ? start.Image.GetPixel(pixelX, pixelY) : end.Image.GetPixel(pixelX, pixelY);
-		},
 		paletteEffectFunc : function(start, end, delta) {
 			var colors = [];
 
@@ -160,9 +190,6 @@ var TransitionManager = function() {
 		showPlayerStart : false,
 		showPlayerEnd : true,
 		stepCount : 6,
-		pixelEffectFunc : function(start, end, pixelX, pixelY, delta) {
-			return delta < 0.5 ? start.Image.GetPixel(pixelX, pixelY) : end.Image.GetPixel(pixelX, pixelY);
-		},
 		paletteEffectFunc : function(start, end, delta) {
 			var colors = [];
 
@@ -189,24 +216,6 @@ var TransitionManager = function() {
 		showPlayerStart : true,
 		showPlayerEnd : true,
 		stepCount : 12,
-		pixelEffectFunc : function(start, end, pixelX, pixelY, delta) {
-			var waveDelta = delta < 0.5 ? delta / 0.5 : 1 - ((delta - 0.5) / 0.5);
-
-			var offset = (pixelY + (waveDelta * waveDelta * 0.2 * start.Image.Height));
-			var freq = 4;
-			var size = 2 + (14 * waveDelta);
-			pixelX += Math.floor(Math.sin(offset / freq) * size);
-
-			if (pixelX < 0) {
-				pixelX += start.Image.Width;
-			}
-			else if (pixelX >= start.Image.Width) {
-				pixelX -= start.Image.Width;
-			}
-
-			var curImage = delta < 0.5 ? start.Image : end.Image;
-			return curImage.GetPixel(pixelX, pixelY);
-		},
 		paletteEffectFunc : function(start, end, delta) {
 			return delta < 0.5 ? start.Palette : end.Palette;
 		},
@@ -216,39 +225,6 @@ var TransitionManager = function() {
 		showPlayerStart : true,
 		showPlayerEnd : true,
 		stepCount : 12,
-		pixelEffectFunc : function(start, end, pixelX, pixelY, delta) {
-			if (delta <= 0.4) {
-				var tunnelDelta = 1 - (delta / 0.4);
-
-				var xDist = start.PlayerCenter.x - pixelX;
-				var yDist = start.PlayerCenter.y - pixelY;
-				var dist = Math.sqrt((xDist * xDist) + (yDist * yDist));
-
-				if (dist > start.Image.Width * tunnelDelta) {
-					return 0;
-				}
-				else {
-					return start.Image.GetPixel(pixelX, pixelY);
-				}
-			}
-			else if (delta <= 0.6) {
-				return 0;
-			}
-			else {
-				var tunnelDelta = (delta - 0.6) / 0.4;
-
-				var xDist = end.PlayerCenter.x - pixelX;
-				var yDist = end.PlayerCenter.y - pixelY;
-				var dist = Math.sqrt((xDist * xDist) + (yDist * yDist));
-
-				if (dist > end.Image.Width * tunnelDelta) {
-					return 0;
-				}
-				else {
-					return end.Image.GetPixel(pixelX, pixelY);
-				}
-			}
-		},
 		paletteEffectFunc : function(start, end, delta) {
 			return delta < 0.5 ? start.Palette : end.Palette;
 		},
@@ -285,18 +261,6 @@ var TransitionManager = function() {
 		showPlayerStart : false,
 		showPlayerEnd : true,
 		stepCount : 8,
-		pixelEffectFunc : function(start, end, pixelX, pixelY, delta) {
-			var pixelOffset = -1 * Math.floor(start.Image.Height * delta);
-			var slidePixelY = pixelY + pixelOffset;
-
-			if (slidePixelY >= 0) {
-				return start.Image.GetPixel(pixelX, slidePixelY);
-			}
-			else {
-				slidePixelY += start.Image.Height;
-				return end.Image.GetPixel(pixelX, slidePixelY);
-			}
-		},
 		paletteEffectFunc : lerpPalettes,
 	});
 
@@ -304,18 +268,6 @@ var TransitionManager = function() {
 		showPlayerStart : false,
 		showPlayerEnd : true,
 		stepCount : 8,
-		pixelEffectFunc : function(start, end, pixelX, pixelY, delta) {
-			var pixelOffset = Math.floor(start.Image.Height * delta);
-			var slidePixelY = pixelY + pixelOffset;
-
-			if (slidePixelY < start.Image.Height) {
-				return start.Image.GetPixel(pixelX, slidePixelY);
-			}
-			else {
-				slidePixelY -= start.Image.Height;
-				return end.Image.GetPixel(pixelX, slidePixelY);
-			}
-		},
 		paletteEffectFunc : lerpPalettes,
 	});
 
@@ -323,18 +275,6 @@ var TransitionManager = function() {
 		showPlayerStart : false,
 		showPlayerEnd : true,
 		stepCount : 8,
-		pixelEffectFunc : function(start, end, pixelX, pixelY, delta) {
-			var pixelOffset = -1 * Math.floor(start.Image.Width * delta);
-			var slidePixelX = pixelX + pixelOffset;
-
-			if (slidePixelX >= 0) {
-				return start.Image.GetPixel(slidePixelX, pixelY);
-			}
-			else {
-				slidePixelX += start.Image.Width;
-				return end.Image.GetPixel(slidePixelX, pixelY);
-			}
-		},
 		paletteEffectFunc : lerpPalettes,
 	});
 
@@ -342,86 +282,29 @@ var TransitionManager = function() {
 		showPlayerStart : false,
 		showPlayerEnd : true,
 		stepCount : 8,
-		pixelEffectFunc : function(start, end, pixelX, pixelY, delta) {
-			var pixelOffset = Math.floor(start.Image.Width * delta);
-			var slidePixelX = pixelX + pixelOffset;
-
-			if (slidePixelX < start.Image.Width) {
-				return start.Image.GetPixel(slidePixelX, pixelY);
-			}
-			else {
-				slidePixelX -= start.Image.Width;
-				return end.Image.GetPixel(slidePixelX, pixelY);
-			}
-		},
 		paletteEffectFunc : lerpPalettes,
 	});
 
 	// todo : move to Renderer()?
-	function createRoomPixelBuffer(room) {
-		var pixelBuffer = [];
-
-		for (var i = 0; i < 128 * 128; i++) {
-			pixelBuffer.push(tileColorStartIndex);
-		}
-
-		var drawTileInPixelBuffer = function(sourceData, frameIndex, colorIndex, tx, ty, pixelBuffer) {
-			var frameData = sourceData[frameIndex];
-
-			for (var y = 0; y < tilesize; y++) {
-				for (var x = 0; x < tilesize; x++) {
-					var color = tileColorStartIndex + (frameData[y][x] === 1 ? colorIndex : 0);
-					pixelBuffer[(((ty * tilesize) + y) * 128) + ((tx * tilesize) + x)] = color;
-				}
-			}
-		}
-
-		//draw tiles
-		for (i in room.tilemap) {
-			for (j in room.tilemap[i]) {
-				var id = room.tilemap[i][j];
-				var x = parseInt(j);
-				var y = parseInt(i);
-
-				if (id != "0" && tile[id] != null) {
-					drawTileInPixelBuffer(
-						renderer.GetDrawingSource(tile[id].drw),
-						tile[id].animation.frameIndex,
-						tile[id].col,
-						x,
-						y,
-						pixelBuffer);
-				}
-			}
-		}
+	function createRoomSnapshot(snapshot, room) {
+		// items and sprites as (tile id, x, y), drawn over the room's tiles in order
+		var drawTiles = [];
 
-		//draw items
 		for (var i = 0; i < room.items.length; i++) {
 			var itm = room.items[i];
-			drawTileInPixelBuffer(
-				renderer.GetDrawingSource(item[itm.id].drw),
-				item[itm.id].animation.frameIndex,
-				item[itm.id].col,
-				itm.x,
-				itm.y,
-				pixelBuffer);
+			drawTiles.push(renderer.GetDrawingFrame(item[itm.id]), itm.x, itm.y);
 		}
 
-		//draw sprites
 		for (id in sprite) {
 			var spr = sprite[id];
 			if (spr.room === room.id) {
-				drawTileInPixelBuffer(
-					renderer.GetDrawingSource(spr.drw),
-					spr.animation.frameIndex,
-					spr.col,
-					spr.x,
-					spr.y,
-					pixelBuffer);
+				drawTiles.push(renderer.GetDrawingFrame(spr), spr.x, spr.y);
 			}
 		}
 
-		return pixelBuffer;
+		bitsySnapshotRoom(snapshot, tileColorStartIndex, getRoomTileIds(room), new Uint16Array(drawTiles));
+
+		return new PostProcessImage(snapshot);
 	}
 
 	function lerpColor(colorA, colorB, t) {
@@ -434,16 +317,13 @@ var TransitionManager = function() {
 }; // TransitionManager()
 
 // todo : is this wrapper still useful?
-var PostProcessImage = function(imageData) {
+var PostProcessImage = function(snapshot) {
 	this.Width = 128;
 	this.Height = 128;
+	this.Snapshot = snapshot; // native room snapshot handle
 
 	this.GetPixel = function(x, y) {
-		return imageData[(y * 128) + x];
-	};
-
-	this.GetData = function() {
-		return imageData;
+		return bitsyGetSnapshotPixel(snapshot, x, y);
 	};
 };
 
@@ -0,0 +1,34 @@
+#ifndef BAKEDFONT_H
+#define BAKEDFONT_H
+
+#include <stdint.h>
+
+/*
+ * .bitsyfont files baked into flash by util/bakefont.js (the generated font.h), so the
+ * default font is never parsed in JS. Char bitmaps are 1-bit rows of ceil(width / 8)
+ * bytes, leftmost pixel in the high bit: the dialog glyph layout, drawn straight from
+ * the tables. Chars are sorted by codepoint.
+ */
+
+typedef struct BakedFontChar
+{
+    uint32_t codepoint;
+    uint8_t width;
+    uint8_t height;
+    int8_t offsetX;
+    int8_t offsetY;
+    uint8_t spacing;
+    uint32_t bitsOffset; // into the font's bits
+} BakedFontChar;
+
+typedef struct BakedFont
+{
+    const char *name; // as passed to FontManager.Get(), without the extension
+    uint8_t width;
+    uint8_t height;
+    const BakedFontChar *chars;
+    uint32_t charCount;
+    const uint8_t *bits;
+} BakedFont;
+
+#endif
@@ -0,0 +1,77 @@
+#ifndef BITSYBOX_H
+#define BITSYBOX_H
+
+#include <TFT_eSPI.h>
+#include "duktape/duktape.h"
+
+#define SYSTEM_PALETTE_MAX 256
+#define SYSTEM_DRAWING_BUFFER_MAX 1024
+
+/* TFT */
+extern TFT_eSPI tft;
+extern TFT_eSprite *drawingBuffers[SYSTEM_DRAWING_BUFFER_MAX];
+
+/* PALETTE */
+// RGB565 colors. Every change to an entry stamps it with the next systemPaletteGeneration,
+// so anything built from palette contents can note the generation it saw and later
+// check only the entries stamped after it
+extern uint16_t systemPalette[SYSTEM_PALETTE_MAX];
+extern uint32_t systemPaletteEntryGeneration[SYSTEM_PALETTE_MAX];
+extern uint32_t systemPaletteGeneration;
+
+/* GAME SELECT */
+extern char gameFilePath[256];
+extern int gameCount;
+
+/* GLOBALS */
+extern int screenSize;
+extern int shouldContinue;
+
+/* INPUT */
+extern int isButtonUp;
+extern int isButtonDown;
+extern int isButtonLeft;
+extern int isButtonRight;
+extern int isButtonW;
+extern int isButtonA;
+extern int isButtonS;
+extern int isButtonD;
+extern int isButtonR;
+extern int isButtonSpace;
+extern int isButtonReturn;
+extern int isButtonEscape;
+extern int isButtonLCtrl;
+extern int isButtonRCtrl;
+extern int isButtonLAlt;
+extern int isButtonRAlt;
+extern int isButtonPadUp;
+extern int isButtonPadDown;
+extern int isButtonPadLeft;
+extern int isButtonPadRight;
+extern int isButtonPadA;
+extern int isButtonPadB;
+extern int isButtonPadX;
+extern int isButtonPadY;
+extern int isButtonPadStart;
+
+/* GAME */
+// gameLoop() split into steps so other drivers (e.g. the host replay harness)
+// can run the game one frame at a time
+duk_context *gameStart();
+void gameUpdate(duk_context *ctx);
+int gameIsOver(duk_context *ctx);
+void gameEnd(duk_context *ctx);
+
+// bytes the VM heap (boot menu or game) holds after a full GC: what it has in the pool
+// when the pool is on, else how much the system heap grew since the VM was created
+uint32_t vmHeapUsed(duk_context *ctx);
+
+// bytes of the system heap in use, the VMs included (malloc's count on the host)
+uint32_t heapUsed();
+
+#ifdef BITSYBOX_HOST
+// write bytecode.h: the embedded engine and boot scripts dumped to Duktape bytecode
+int hostCompileEngine(const char *path);
+#endif
+
+#endif
@@ -0,0 +1,589 @@
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include <atomic>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/queue.h>
+#include "bitsybox.h"
+#include "display.h"
+#include "profiler.h"
+
+#define DISPLAY_SIZE (DISPLAY_CELLS * DISPLAY_CELL_SIZE)
+#define DISPLAY_RECT_MAX (DISPLAY_CELLS * DISPLAY_CELLS)
+
+typedef struct DisplayRect
+{
+    int x; // in cells
+    int y;
+    int w;
+    int h;
+} DisplayRect;
+
+// systemPalette byte-swapped so rows can be streamed with swapBytes off (bus order is
+// big-endian), as of systemPaletteGeneration lookupGeneration: the last time the screen
+// was drawn into, so the frame goes out in the colors it was drawn with
+static uint16_t paletteLookup[SYSTEM_PALETTE_MAX];
+static uint32_t lookupGeneration = 0;
+static bool isPaletteChanged = true;
+
+// the screen is scaled nearest-neighbor and centered on the panel; the letterbox
+// around it is never written to. screen pixel i covers panel pixels scaledEdges[i] up
+// to scaledEdges[i + 1] on both axes: all the same width at an integer scale, a mix of
+// two widths with DISPLAY_SCALE_FILL (1 and 2 pixels for 240x240)
+static int displaySize = DISPLAY_SIZE;
+static int displayX = 0; // panel position of the scaled screen
+static int displayY = 0;
+static uint16_t scaledEdges[DISPLAY_SIZE + 1];
+
+// one scaled row, expanded on the fly and pushed once per output line
+static uint16_t lineBuffer[DISPLAY_SIZE * DISPLAY_SCALE_MAX];
+
+// the screen buffer as last sent to the panel, and the cells drawn into since then
+static uint8_t presented[DISPLAY_SIZE * DISPLAY_SIZE];
+static bool isCellTouched[DISPLAY_CELLS][DISPLAY_CELLS];
+static bool isCellDirty[DISPLAY_CELLS][DISPLAY_CELLS];
+static bool isFullRedraw = true;
+
+static DisplayRect rects[DISPLAY_RECT_MAX];
+// written by whichever task presents (the display task with one), read by the VM task
+static std::atomic<int> cellsPushed(0);
+
+// DMA present: a frame's rects are expanded into one of two transfer buffers while
+// the other may still be on its way to the panel
+static bool isDmaEnabled = false;
+static uint16_t *transferBuffers[2] = {NULL, NULL};
+static int transferIndex = 0;
+static bool isTransferPending = false; // bus held by a started transfer
+
+// a band of scaled lines in a transfer buffer, sent with one pushImageDMA
+typedef struct TransferImage
+{
+    int x; // panel pixels
+    int y;
+    int w;
+    int h;
+    uint16_t *pixels;
+} TransferImage;
+
+// display task present: frame slots are handed back and forth by index, queued
+// frames go to the display task and presented ones come back to the free queue
+typedef struct DisplayFrame
+{
+    uint8_t pixels[DISPLAY_SIZE * DISPLAY_SIZE]; // only touched cells are copied
+    uint16_t lookup[SYSTEM_PALETTE_MAX];
+    bool isCellTouched[DISPLAY_CELLS][DISPLAY_CELLS];
+    bool isFull;
+} DisplayFrame;
+
+static bool isTaskEnabled = false;
+static DisplayFrame *frames = NULL;
+static QueueHandle_t freeFrames = NULL;
+static QueueHandle_t queuedFrames = NULL;
+
+static void presentFrame(const uint8_t *pixels, const uint16_t *lookup, bool (*touched)[DISPLAY_CELLS], bool isFull);
+
+static void displayTask(void *parameters)
+{
+    for (;;)
+    {
+        int slot;
+        xQueueReceive(queuedFrames, &slot, portMAX_DELAY);
+
+        DisplayFrame *frame = &frames[slot];
+        presentFrame(frame->pixels, frame->lookup, frame->isCellTouched, frame->isFull);
+
+        xQueueSend(freeFrames, &slot, portMAX_DELAY);
+    }
+}
+
+static bool initTask()
+{
+    frames = (DisplayFrame *)malloc(DISPLAY_QUEUE_LENGTH * sizeof(DisplayFrame));
+    freeFrames = xQueueCreate(DISPLAY_QUEUE_LENGTH, sizeof(int));
+    queuedFrames = xQueueCreate(DISPLAY_QUEUE_LENGTH, sizeof(int));
+
+    if (frames == NULL || freeFrames == NULL || queuedFrames == NULL)
+    {
+        return false;
+    }
+
+    for (int slot = 0; slot < DISPLAY_QUEUE_LENGTH; slot++)
+    {
+        xQueueSend(freeFrames, &slot, 0);
+    }
+
+    return xTaskCreatePinnedToCore(displayTask, "display", 4096, NULL, 2, NULL, DISPLAY_TASK_CORE) == pdPASS;
+}
+
+static bool initDMA()
+{
+    for (int i = 0; i < 2; i++)
+    {
+        transferBuffers[i] = (uint16_t *)malloc(DISPLAY_SIZE * DISPLAY_SIZE * sizeof(uint16_t));
+    }
+
+    if (transferBuffers[0] != NULL && transferBuffers[1] != NULL && tft.initDMA())
+    {
+        return true;
+    }
+
+    free(transferBuffers[0]);
+    free(transferBuffers[1]);
+    transferBuffers[0] = transferBuffers[1] = NULL;
+
+    return false;
+}
+
+void displayInit(bool isTaskRequested)
+{
+    int fit = min(tft.width(), tft.height());
+#if DISPLAY_SCALE_FILL
+    displaySize = min(max(fit, DISPLAY_SIZE), DISPLAY_SIZE * DISPLAY_SCALE_MAX);
+#else
+    displaySize = DISPLAY_SIZE * min(max(fit / DISPLAY_SIZE, 1), DISPLAY_SCALE_MAX);
+#endif
+    displayX = max(0, (tft.width() - displaySize) / 2);
+    displayY = max(0, (tft.height() - displaySize) / 2);
+
+    for (int i = 0; i <= DISPLAY_SIZE; i++)
+    {
+        scaledEdges[i] = (uint16_t)((i * displaySize) / DISPLAY_SIZE);
+    }
+
+    tft.fillScreen(TFT_BLACK);
+
+    // the display task pushes with blocking writes: it has a core to itself, so the
+    // 64KB of DMA transfer buffers are only needed without it
+    isTaskEnabled = isTaskRequested && initTask();
+
+    if (isTaskRequested && !isTaskEnabled)
+    {
+        Serial.println("Display task unavailable: presenting from the VM task");
+    }
+
+    isDmaEnabled = !isTaskEnabled && initDMA();
+
+    if (!isTaskEnabled && !isDmaEnabled)
+    {
+        Serial.println("DMA unavailable: presenting without it");
+    }
+}
+
+void displayFlush()
+{
+    // every slot back in the free queue: nothing queued and nothing being pushed
+    while (isTaskEnabled && uxQueueMessagesWaiting(freeFrames) < DISPLAY_QUEUE_LENGTH)
+    {
+        taskYIELD();
+    }
+
+    if (isTransferPending)
+    {
+        tft.dmaWait();
+        tft.endWrite();
+        isTransferPending = false;
+    }
+}
+
+// copy the entries written since the last sync; returns true only if a color really
+// differs from the last frame (resetting the palette and setting it back is no change)
+static bool syncPalette()
+{
+    if (lookupGeneration == systemPaletteGeneration)
+    {
+        return false;
+    }
+
+    bool isChanged = false;
+
+    for (int i = 0; i < SYSTEM_PALETTE_MAX; i++)
+    {
+        if (systemPaletteEntryGeneration[i] <= lookupGeneration)
+        {
+            continue;
+        }
+
+        uint16_t color = (uint16_t)((systemPalette[i] << 8) | (systemPalette[i] >> 8));
+
+        if (paletteLookup[i] != color)
+        {
+            paletteLookup[i] = color;
+            isChanged = true;
+        }
+    }
+
+    lookupGeneration = systemPaletteGeneration;
+
+    return isChanged;
+}
+
+void displayMarkDrawn()
+{
+    // a palette change recolors every cell without changing any index
+    isPaletteChanged = syncPalette() || isPaletteChanged;
+}
+
+void displayMarkDirty(int x, int y, int w, int h)
+{
+    displayMarkDrawn();
+
+    int left = max(0, x / DISPLAY_CELL_SIZE);
+    int top = max(0, y / DISPLAY_CELL_SIZE);
+    int right = min(DISPLAY_CELLS - 1, (x + w - 1) / DISPLAY_CELL_SIZE);
+    int bottom = min(DISPLAY_CELLS - 1, (y + h - 1) / DISPLAY_CELL_SIZE);
+
+    for (int row = top; row <= bottom; row++)
+    {
+        for (int col = left; col <= right; col++)
+        {
+            isCellTouched[row][col] = true;
+        }
+    }
+}
+
+void displayMarkAllDirty()
+{
+    isFullRedraw = true;
+}
+
+int displayCellsPushed()
+{
+    return cellsPushed.load(std::memory_order_relaxed);
+}
+
+// compare a touched cell against what the panel shows, updating the copy if it changed
+static bool updateCell(const uint8_t *pixels, int col, int row)
+{
+    int offset = (row * DISPLAY_CELL_SIZE * DISPLAY_SIZE) + (col * DISPLAY_CELL_SIZE);
+    bool isChanged = false;
+
+    for (int y = 0; y < DISPLAY_CELL_SIZE; y++, offset += DISPLAY_SIZE)
+    {
+        if (memcmp(pixels + offset, presented + offset, DISPLAY_CELL_SIZE) != 0)
+        {
+            memcpy(presented + offset, pixels + offset, DISPLAY_CELL_SIZE);
+            isChanged = true;
+        }
+    }
+
+    return isChanged;
+}
+
+// merge dirty cells into rectangles: horizontal runs in each row, extended downwards
+// while the next row has a run with exactly the same span
+static int mergeDirtyCells()
+{
+    int rectCount = 0;
+    int openStart = 0; // rects that may still grow into the current row
+
+    for (int row = 0; row < DISPLAY_CELLS; row++)
+    {
+        int openEnd = rectCount;
+        int col = 0;
+
+        while (col < DISPLAY_CELLS)
+        {
+            if (!isCellDirty[row][col])
+            {
+                col++;
+                continue;
+            }
+
+            int start = col;
+            while (col < DISPLAY_CELLS && isCellDirty[row][col])
+            {
+                col++;
+            }
+
+            bool isExtended = false;
+            for (int i = openStart; i < openEnd; i++)
+            {
+                if (rects[i].x == start && rects[i].w == col - start && rects[i].y + rects[i].h == row)
+                {
+                    rects[i].h++;
+                    isExtended = true;
+                    break;
+                }
+            }
+
+            if (!isExtended)
+            {
+                rects[rectCount++] = (DisplayRect){start, row, col - start, 1};
+            }
+        }
+
+        // rects that did not reach this row are finished
+        int next = openStart;
+        for (int i = openStart; i < rectCount; i++)
+        {
+            if (rects[i].y + rects[i].h < row + 1)
+            {
+                DisplayRect closed = rects[i];
+                rects[i] = rects[next];
+                rects[next++] = closed;
+            }
+        }
+        openStart = next;
+    }
+
+    return rectCount;
+}
+
+// expand one row of the presented screen through the lookup table, scaled to the
+// panel's width; returns the pixel count
+static int expandLine(int x, int w, int row, const uint16_t *lookup, uint16_t *dst)
+{
+    const uint8_t *src = presented + (row * DISPLAY_SIZE) + x;
+
+    if (displaySize == DISPLAY_SIZE)
+    {
+        for (int i = 0; i < w; i++)
+        {
+            *dst++ = lookup[src[i]];
+        }
+
+        return w;
+    }
+
+    for (int i = 0; i < w; i++)
+    {
+        uint16_t color = lookup[src[i]];
+        for (int repeat = scaledEdges[x + i]; repeat < scaledEdges[x + i + 1]; repeat++)
+        {
+            *dst++ = color;
+        }
+    }
+
+    return scaledEdges[x + w] - scaledEdges[x];
+}
+
+// send the images of the current transfer buffer and switch to the other one
+static void startTransfers(const TransferImage *images, int imageCount)
+{
+    // the other buffer may still be on its way to the panel
+    unsigned long waitStart = micros();
+    displayFlush();
+
+    tft.startWrite();
+    isTransferPending = true;
+
+    // each transfer waits for the one before, only the last overlaps the next update
+    for (int i = 0; i < imageCount; i++)
+    {
+        tft.pushImageDMA(images[i].x, images[i].y, images[i].w, images[i].h, images[i].pixels);
+    }
+
+    profileCount(PROFILE_PRESENT_WAIT_US, (uint32_t)(micros() - waitStart));
+
+    transferIndex ^= 1;
+}
+
+// expand the rects' scaled lines into the transfer buffers: unscaled, a frame always
+// fits in one; scaled, a full buffer is sent and the next lines go into the other
+// while it transfers
+static void pushRectsDMA(int rectCount, const uint16_t *lookup)
+{
+    TransferImage images[DISPLAY_RECT_MAX + 1]; // a rect split across buffers adds one
+    int imageCount = 0;
+    uint16_t *buffer = transferBuffers[transferIndex];
+    int used = 0;
+
+    for (int i = 0; i < rectCount; i++)
+    {
+        int x = rects[i].x * DISPLAY_CELL_SIZE;
+        int y = rects[i].y * DISPLAY_CELL_SIZE;
+        int w = rects[i].w * DISPLAY_CELL_SIZE;
+        int h = rects[i].h * DISPLAY_CELL_SIZE;
+        int scaledW = scaledEdges[x + w] - scaledEdges[x];
+        TransferImage *image = NULL;
+
+        for (int row = y; row < y + h; row++)
+        {
+            int lines = scaledEdges[row + 1] - scaledEdges[row];
+
+            if (used + (scaledW * lines) > DISPLAY_SIZE * DISPLAY_SIZE)
+            {
+                startTransfers(images, imageCount);
+                imageCount = 0;
+                buffer = transferBuffers[transferIndex];
+                used = 0;
+                image = NULL;
+            }
+
+            if (image == NULL)
+            {
+                image = &images[imageCount++];
+                *image = (TransferImage){displayX + scaledEdges[x], displayY + scaledEdges[row], scaledW, 0, buffer + used};
+            }
+
+            // nearest neighbor: every output line of a scaled row is the same
+            uint16_t *line = buffer + used;
+            expandLine(x, w, row, lookup, line);
+            for (int repeat = 1; repeat < lines; repeat++)
+            {
+                memcpy(line + (repeat * scaledW), line, scaledW * sizeof(uint16_t));
+            }
+
+            used += scaledW * lines;
+            image->h += lines;
+        }
+    }
+
+    startTransfers(images, imageCount);
+}
+
+static void pushRect(const DisplayRect &rect, const uint16_t *lookup)
+{
+    int x = rect.x * DISPLAY_CELL_SIZE;
+    int y = rect.y * DISPLAY_CELL_SIZE;
+    int w = rect.w * DISPLAY_CELL_SIZE;
+    int h = rect.h * DISPLAY_CELL_SIZE;
+
+    int scaledW = scaledEdges[x + w] - scaledEdges[x];
+    int scaledH = scaledEdges[y + h] - scaledEdges[y];
+
+    tft.setAddrWindow(displayX + scaledEdges[x], displayY + scaledEdges[y], scaledW, scaledH);
+
+    for (int row = y; row < y + h; row++)
+    {
+        expandLine(x, w, row, lookup, lineBuffer);
+
+        // nearest neighbor: every output line of a scaled row is the same
+        for (int repeat = scaledEdges[row]; repeat < scaledEdges[row + 1]; repeat++)
+        {
+            tft.pushPixels(lineBuffer, scaledW);
+        }
+    }
+}
+
+// compare, merge and push one frame (on the display task, or the VM task without it)
+static void presentFrame(const uint8_t *pixels, const uint16_t *lookup, bool (*touched)[DISPLAY_CELLS], bool isFull)
+{
+    int pushed = 0;
+
+    for (int row = 0; row < DISPLAY_CELLS; row++)
+    {
+        for (int col = 0; col < DISPLAY_CELLS; col++)
+        {
+            bool isChanged = touched[row][col] && updateCell(pixels, col, row);
+
+            isCellDirty[row][col] = isFull || isChanged;
+            touched[row][col] = false;
+
+            if (isCellDirty[row][col])
+            {
+                pushed++;
+            }
+        }
+    }
+
+    if (isFull)
+    {
+        memcpy(presented, pixels, sizeof(presented));
+    }
+
+    cellsPushed.store(pushed, std::memory_order_relaxed);
+
+    if (pushed == 0)
+    {
+        return;
+    }
+
+    int rectCount = mergeDirtyCells();
+
+    bool swapBytes = tft.getSwapBytes();
+    tft.setSwapBytes(false);
+
+    if (isDmaEnabled)
+    {
+        pushRectsDMA(rectCount, lookup);
+    }
+    else
+    {
+        tft.startWrite();
+
+        for (int i = 0; i < rectCount; i++)
+        {
+            pushRect(rects[i], lookup);
+        }
+
+        tft.endWrite();
+    }
+
+    tft.setSwapBytes(swapBytes);
+}
+
+// copy the touched cells (all of them for a full redraw) into a free slot for the
+// display task; returns false if every slot is still queued or being pushed
+static bool queueFrame(const uint8_t *pixels, bool isFull)
+{
+    int slot;
+    if (xQueueReceive(freeFrames, &slot, 0) != pdTRUE)
+    {
+        return false;
+    }
+
+    DisplayFrame *frame = &frames[slot];
+
+    if (isFull)
+    {
+        memcpy(frame->pixels, pixels, sizeof(frame->pixels));
+    }
+    else
+    {
+        for (int row = 0; row < DISPLAY_CELLS; row++)
+        {
+            for (int col = 0; col < DISPLAY_CELLS; col++)
+            {
+                if (!isCellTouched[row][col])
+                {
+                    continue;
+                }
+
+                int offset = (row * DISPLAY_CELL_SIZE * DISPLAY_SIZE) + (col * DISPLAY_CELL_SIZE);
+                for (int y = 0; y < DISPLAY_CELL_SIZE; y++, offset += DISPLAY_SIZE)
+                {
+                    memcpy(frame->pixels + offset, pixels + offset, DISPLAY_CELL_SIZE);
+                }
+            }
+        }
+    }
+
+    memcpy(frame->lookup, paletteLookup, sizeof(frame->lookup));
+    memcpy(frame->isCellTouched, isCellTouched, sizeof(frame->isCellTouched));
+    memset(isCellTouched, 0, sizeof(isCellTouched));
+    frame->isFull = isFull;
+
+    xQueueSend(queuedFrames, &slot, portMAX_DELAY);
+    profileCount(PROFILE_QUEUE_DEPTH, uxQueueMessagesWaiting(queuedFrames));
+
+    return true;
+}
+
+void displayPresent(TFT_eSprite *screen)
+{
+    const uint8_t *pixels = (const uint8_t *)screen->getPointer();
+    if (pixels == NULL || screen->width() != DISPLAY_SIZE || screen->height() != DISPLAY_SIZE)
+    {
+        return;
+    }
+
+    bool isFull = isFullRedraw || isPaletteChanged;
+
+    if (isTaskEnabled)
+    {
+        // a dropped frame keeps its touched cells and full redraw for the next one
+        if (!queueFrame(pixels, isFull))
+        {
+            profileCount(PROFILE_FRAMES_DROPPED, 1);
+            return;
+        }
+    }
+    else
+    {
+        presentFrame(pixels, paletteLookup, isCellTouched, isFull);
+    }
+
+    isFullRedraw = false;
+    isPaletteChanged = false;
+}
@@ -0,0 +1,80 @@
+#ifndef DISPLAY_H
+#define DISPLAY_H
+
+#include <TFT_eSPI.h>
+
+/*
+ * Drawing buffers hold 8-bit palette indices (sprites created with setColorDepth(8),
+ * written through getPointer() rather than the sprite's own RGB332 drawing calls).
+ * Colors are only resolved when the screen buffer is presented, through a 565
+ * lookup table, so palette changes never touch pixels. The table is synced from
+ * systemPalette whenever the screen is drawn into, not at present: a palette set after
+ * a frame's last drawing (the next room's, the next fade step's) waits for the frame
+ * that draws with it instead of recoloring the one already drawn.
+ *
+ * The 128x128 screen is tracked as a 16x16 grid of 8x8 cells. Drawing calls mark the
+ * cells they touch; present compares those against what the panel already shows and
+ * only sends the cells that really changed, merged into rectangles.
+ *
+ * Presenting runs in one of two modes:
+ * - display task: the VM (Arduino's loop task, pinned to core 1) copies the touched
+ *   cells and the lookup table into a free frame slot and queues it; a task pinned
+ *   to core 0 compares, merges and pushes it while the next frame runs. With no free
+ *   slot the frame is dropped and its touched cells carry over to the next one.
+ * - DMA: changed rects are expanded to 565 into one of two transfer buffers and sent
+ *   by DMA from the VM task, so only the transfer overlaps the next frame's update.
+ *
+ * On panels larger than the screen it is drawn at the largest integer scale that fits
+ * (up to DISPLAY_SCALE_MAX), centered with a black letterbox, or with DISPLAY_SCALE_FILL
+ * at the non-integer scale that fills the panel's short side. Scaling happens while
+ * pushing, so no scaled framebuffer is ever allocated: blocking pushes expand each row
+ * of a rect into a line buffer sent once per output line, DMA expands the scaled lines
+ * into the transfer buffers, sending one when it is full and going on in the other.
+ */
+
+#define DISPLAY_CELL_SIZE 8
+#define DISPLAY_CELLS 16 // per side
+
+#define DISPLAY_SCALE_MAX 4 // 512 pixel wide panels; sizes the line buffer
+
+// 1: scale to fill the panel's short side (a 240x240 panel gets 1.875x, rows and columns
+// alternately 1 and 2 pixels wide) instead of the largest integer scale (1x there)
+#ifndef DISPLAY_SCALE_FILL
+#define DISPLAY_SCALE_FILL 0
+#endif
+
+#define DISPLAY_QUEUE_LENGTH 2 // frame slots between the VM and the display task
+#define DISPLAY_TASK_CORE 0    // the Arduino loop task (the VM) runs on core 1
+
+// off by default: presents then go out over DMA from the VM task, and the display
+// task (a core-0 task pushing with blocking writes) is left to the esp32dev_task env
+#ifndef DISPLAY_TASK_ENABLED
+#define DISPLAY_TASK_ENABLED 0
+#endif
+
+// start the display task, or set up DMA transfers without it (either falls back to
+// the next: display task, then DMA, then blocking pushes)
+void displayInit(bool isTaskEnabled);
+
+// note that the screen buffer was drawn with the current palette (displayMarkDirty()
+// does too), even if no pixel changed
+void displayMarkDrawn();
+
+// note that a pixel rect of the screen buffer was drawn into
+void displayMarkDirty(int x, int y, int w, int h);
+
+// send the whole screen on the next present (e.g. after the panel was drawn over)
+void displayMarkAllDirty();
+
+// send the changed cells of an indexed screen buffer to the panel. This returns once
+// the frame is queued (display task) or its transfer started (DMA); the screen buffer
+// may be drawn into again straight away, the panel catches up while the next frame runs.
+void displayPresent(TFT_eSprite *screen);
+
+// wait until the panel shows everything presented so far
+void displayFlush();
+
+// number of cells sent by the last present that reached the panel
+int displayCellsPushed();
+
+#endif
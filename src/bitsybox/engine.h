@@ -176,6 +176,25 @@ char* bitsy_js =
 	"	}\n"
 	"}\n"
 	"\n"
+	"// return the engine to how it was right after loading, so one VM can run the boot menu\n"
+	"// and any number of games in turn. bitsybox restores top-level values and functions\n"
+	"// from a snapshot of the globals; this rebuilds the objects, closures included.\n"
+	"function resetEngine() {\n"
+	"	clearGameData();\n"
+	"	resetFlags();\n"
+	"	roomTileIdCache = {};\n"
+	"\n"
+	"	bitsyResetColors();\n"
+	"	renderer.ClearCache(); // releases the native tiles\n"
+	"	renderer = new TileRenderer(tilesize);\n"
+	"	transition = new TransitionManager();\n"
+	"	dialogRenderer = dialogModule.CreateRenderer();\n"
+	"	dialogBuffer = dialogModule.CreateBuffer();\n"
+	"	fontManager = new FontManager();\n"
+	"	scriptInterpreter = scriptModule.CreateInterpreter();\n"
+	"	scriptUtils = scriptModule.CreateUtils();\n"
+	"}\n"
+	"\n"
 	"function onready(startWithTitle) {\n"
 	"	if (startWithTitle === undefined || startWithTitle === null) {\n"
 	"		startWithTitle = true;\n"
@@ -339,6 +358,7 @@ char* bitsy_js =
 	"\n"
 	"var animationCounter = 0;\n"
 	"var animationTime = 400;\n"
+	"var animationGeneration = 0; // bumped whenever any animation frame changes\n"
 	"function updateAnimation() {\n"
 	"	animationCounter += deltaTime;\n"
 	"\n"
@@ -370,11 +390,14 @@ char* bitsy_js =
 	"\n"
 	"		// reset counter\n"
 	"		animationCounter = 0;\n"
+	"		animationGeneration++;\n"
 	"\n"
 	"	}\n"
 	"}\n"
 	"\n"
 	"function resetAllAnimations() {\n"
+	"	animationGeneration++;\n"
+	"\n"
 	"	for (id in sprite) {\n"
 	"		var spr = sprite[id];\n"
 	"		if (spr.animation.isAnimated) {\n"
@@ -1152,6 +1175,7 @@ char* bitsy_js =
 	"	room[id] = {\n"
 	"		id : id,\n"
 	"		tilemap : [],\n"
+	"		tilemapVersion : 0, // bumped on every write to tilemap, see setRoomTile()\n"
 	"		walls : [],\n"
 	"		exits : [],\n"
 	"		endings : [],\n"
@@ -1188,6 +1212,8 @@ char* bitsy_js =
 	"		}\n"
 	"	}\n"
 	"\n"
+	"	room[id].tilemapVersion++;\n"
+	"\n"
 	"	while (i < lines.length && lines[i].length > 0) { //look for empty line\n"
 	"		// bitsyLog(getType(lines[i]));\n"
 	"		if (getType(lines[i]) === \"SPR\") {\n"
@@ -1211,7 +1237,7 @@ char* bitsy_js =
 	"						var col = room[id].tilemap[row].indexOf( sprList[s] );\n"
 	"						//if the sprite is in this row, replace it with the \"null tile\" and set its starting position\n"
 	"						if (col != -1) {\n"
-	"							room[id].tilemap[row][col] = \"0\";\n"
+	"							setRoomTile(room[id], col, row, \"0\");\n"
 	"							spriteStartLocations[ sprList[s] ] = {\n"
 	"								room : id,\n"
 	"								x : parseInt(col),\n"
@@ -1684,32 +1710,12 @@ char* bitsy_js =
 	"		return;\n"
 	"	}\n"
 	"\n"
-	"	// clear the screen buffer\n"
+	"	//draw tiles over the background color (only the cells that changed or were drawn\n"
+	"	// over since the last frame are touched, see bitsyDrawRoom)\n"
 	"	bitsyDrawBegin(0);\n"
-	"	bitsyClear(tileColorStartIndex);\n"
+	"	bitsyDrawRoom(getRoomTileIds(room, frameIndex), tileColorStartIndex);\n"
 	"	bitsyDrawEnd();\n"
 	"\n"
-	"	//draw tiles\n"
-	"	for (i in room.tilemap) {\n"
-	"		for (j in room.tilemap[i]) {\n"
-	"			var id = room.tilemap[i][j];\n"
-	"			var x = parseInt(j);\n"
-	"			var y = parseInt(i);\n"
-	"\n"
-	"			if (id != \"0\") {\n"
-	"				//bitsyLog(id);\n"
-	"				if (tile[id] == null) { // hack-around to avoid corrupting files (not a solution though!)\n"
-	"					id = \"0\";\n"
-	"					room.tilemap[i][j] = id;\n"
-	"				}\n"
-	"				else {\n"
-	"					// bitsyLog(id);\n"
-	"					drawTile(getTileFrame(tile[id], frameIndex), x, y);\n"
-	"				}\n"
-	"			}\n"
-	"		}\n"
-	"	}\n"
-	"\n"
 	"	//draw items\n"
 	"	for (var i = 0; i < room.items.length; i++) {\n"
 	"		var itm = room.items[i];\n"
@@ -1725,6 +1731,60 @@ char* bitsy_js =
 	"	}\n"
 	"}\n"
 	"\n"
+	"// write one cell of a room's tilemap. code that edits room.tilemap in place some other\n"
+	"// way must bump room.tilemapVersion itself, or the room keeps drawing the old tiles\n"
+	"function setRoomTile(room, x, y, id) {\n"
+	"	room.tilemap[y][x] = id;\n"
+	"	room.tilemapVersion++;\n"
+	"}\n"
+	"\n"
+	"// tile buffer id for every cell of a room (0 = empty), as drawn by bitsyDrawRoom().\n"
+	"// only rebuilt when the render cache, the animation frame or the room's tilemap\n"
+	"// (replaced, or edited as counted by tilemapVersion) changes\n"
+	"var roomTileIdCache = {};\n"
+	"\n"
+	"function getRoomTileIds(room, frameIndex) {\n"
+	"	var renderGeneration = renderer.GetCacheGeneration();\n"
+	"	var cache = roomTileIdCache[room.id];\n"
+	"\n"
+	"	if (cache != undefined && cache.tilemap === room.tilemap && cache.tilemapVersion === room.tilemapVersion &&\n"
+	"		cache.renderGeneration === renderGeneration &&\n"
+	"		cache.animationGeneration === animationGeneration && cache.frameIndex === frameIndex) {\n"
+	"		return cache.tileIds;\n"
+	"	}\n"
+	"\n"
+	"	if (cache == undefined) {\n"
+	"		cache = { tileIds: new Uint16Array(mapsize * mapsize) };\n"
+	"		roomTileIdCache[room.id] = cache;\n"
+	"	}\n"
+	"\n"
+	"	for (var y = 0; y < mapsize; y++) {\n"
+	"		for (var x = 0; x < mapsize; x++) {\n"
+	"			var id = room.tilemap[y][x];\n"
+	"			var tileId = 0;\n"
+	"\n"
+	"			if (id != \"0\") {\n"
+	"				if (tile[id] == null) { // hack-around to avoid corrupting files (not a solution though!)\n"
+	"					setRoomTile(room, x, y, \"0\");\n"
+	"				}\n"
+	"				else {\n"
+	"					tileId = getTileFrame(tile[id], frameIndex);\n"
+	"				}\n"
+	"			}\n"
+	"\n"
+	"			cache.tileIds[(y * mapsize) + x] = tileId;\n"
+	"		}\n"
+	"	}\n"
+	"\n"
+	"	cache.tilemap = room.tilemap;\n"
+	"	cache.tilemapVersion = room.tilemapVersion; // after the hack-around above bumped it\n"
+	"	cache.renderGeneration = renderGeneration;\n"
+	"	cache.animationGeneration = animationGeneration;\n"
+	"	cache.frameIndex = frameIndex;\n"
+	"\n"
+	"	return cache.tileIds;\n"
+	"}\n"
+	"\n"
 	"// TODO : remove these get*Image methods\n"
 	"function getTileFrame(t, frameIndex) {\n"
 	"	return renderer.GetDrawingFrame(t, frameIndex);\n"
@@ -1953,6 +2013,8 @@ char* dialog_js =
 	"	var font = null;\n"
 	"	this.SetFont = function(f) {\n"
 	"		font = f;\n"
+	"		isGlyphTableStale = true; // re-upload glyphs for the new font\n"
+	"		drawnPage = null; // the textbox buffer is recreated below\n"
 	"		textboxInfo.height = (textboxInfo.padding_vert * 3) + (relativeFontHeight() * 2) + textboxInfo.arrow_height;\n"
 	"\n"
 	"		// todo : clean up all the scale stuff\n"
@@ -2009,6 +2071,47 @@ char* dialog_js =
 	"		0,0,1,0,0\n"
 	"	];\n"
 	"\n"
+	"	// native glyph table ids (see bitsyDrawGlyph), uploaded the first time a char is\n"
+	"	// drawn. glyphs are 1-bit and take their color index when drawn, so only a new font\n"
+	"	// (set on every game load, after the drawings are parsed) rebuilds the table: room\n"
+	"	// changes and palette changes keep it\n"
+	"	var glyphIds = {};\n"
+	"	var isGlyphTableStale = true;\n"
+	"\n"
+	"	function resetGlyphs() {\n"
+	"		bitsyResetGlyphs();\n"
+	"		glyphIds = {};\n"
+	"		isGlyphTableStale = false;\n"
+	"	}\n"
+	"\n"
+	"	// one byte per 8 pixels of a row, leftmost pixel in the high bit\n"
+	"	function packGlyph(bitmap, width, height) {\n"
+	"		var stride = Math.ceil(width / 8);\n"
+	"		var bits = new Uint8Array(stride * height);\n"
+	"\n"
+	"		for (var y = 0; y < height; y++) {\n"
+	"			for (var x = 0; x < width; x++) {\n"
+	"				if (bitmap[(y * width) + x] == 1) {\n"
+	"					bits[(y * stride) + (x >> 3)] |= 0x80 >> (x & 7);\n"
+	"				}\n"
+	"			}\n"
+	"		}\n"
+	"\n"
+	"		return bits;\n"
+	"	}\n"
+	"\n"
+	"	// glyph id for a key, or -1 if the table is full (draw pixel by pixel instead)\n"
+	"	function getGlyphId(key, bitmap, width, height) {\n"
+	"		var glyphId = glyphIds[key];\n"
+	"\n"
+	"		if (glyphId === undefined) {\n"
+	"			glyphId = bitsyAddGlyph(width, height, packGlyph(bitmap, width, height));\n"
+	"			glyphIds[key] = glyphId;\n"
+	"		}\n"
+	"\n"
+	"		return glyphId;\n"
+	"	}\n"
+	"\n"
 	"	this.DrawNextArrow = function() {\n"
 	"		// bitsyLog(\"draw arrow!\");\n"
 	"		bitsyDrawBegin(1);\n"
@@ -2019,6 +2122,15 @@ char* dialog_js =
 	"			left = 4 * text_scale;\n"
 	"		}\n"
 	"\n"
+	"		arrowRect = { x: left, y: top, w: 5 * text_scale, h: 3 * text_scale };\n"
+	"\n"
+	"		var arrowGlyphId = getGlyphId(\"arrow\", scaledArrowData(), 5 * text_scale, 3 * text_scale);\n"
+	"		if (arrowGlyphId >= 0) {\n"
+	"			bitsyDrawGlyph(arrowGlyphId, left, top, textArrowIndex);\n"
+	"			bitsyDrawEnd();\n"
+	"			return;\n"
+	"		}\n"
+	"\n"
 	"		for (var y = 0; y < 3; y++) {\n"
 	"			for (var x = 0; x < 5; x++) {\n"
 	"				var i = (y * 5) + x;\n"
@@ -2036,6 +2148,18 @@ char* dialog_js =
 	"		bitsyDrawEnd();\n"
 	"	};\n"
 	"\n"
+	"	function scaledArrowData() {\n"
+	"		var bitmap = [];\n"
+	"\n"
+	"		for (var y = 0; y < 3 * text_scale; y++) {\n"
+	"			for (var x = 0; x < 5 * text_scale; x++) {\n"
+	"				bitmap.push(arrowdata[(Math.floor(y / text_scale) * 5) + Math.floor(x / text_scale)]);\n"
+	"			}\n"
+	"		}\n"
+	"\n"
+	"		return bitmap;\n"
+	"	}\n"
+	"\n"
 	"	var text_scale = 2; //using a different scaling factor for text feels like cheating... but it looks better\n"
 	"	this.DrawChar = function(char, row, col, leftPos) {\n"
 	"		bitsyDrawBegin(1);\n"
@@ -2053,12 +2177,24 @@ char* dialog_js =
 	"		var top = (4 * text_scale) + (row * 2 * text_scale) + (row * font.getHeight()) + Math.floor(char.offset.y);\n"
 	"		var left = (4 * text_scale) + leftPos + Math.floor(char.offset.x);\n"
 	"\n"
-	"		for (var y = 0; y < char.height; y++) {\n"
-	"			for (var x = 0; x < char.width; x++) {\n"
-	"				var i = (y * char.width) + x;\n"
-	"				if (charData[i] == 1) {\n"
-	"					// todo : other colors\n"
-	"					bitsyDrawPixel(char.color, left + x, top + y);\n"
+	"		char.drawnRect = { x: left, y: top, w: char.width, h: char.height };\n"
+	"\n"
+	"		var glyphId = char.glyphId;\n"
+	"		if (glyphId < 0 && char.glyphKey != null && char.width > 0 && char.height > 0) {\n"
+	"			glyphId = getGlyphId(char.glyphKey, charData, char.width, char.height);\n"
+	"		}\n"
+	"\n"
+	"		if (glyphId >= 0) {\n"
+	"			bitsyDrawGlyph(glyphId, left, top, char.color);\n"
+	"		}\n"
+	"		else {\n"
+	"			for (var y = 0; y < char.height; y++) {\n"
+	"				for (var x = 0; x < char.width; x++) {\n"
+	"					var i = (y * char.width) + x;\n"
+	"					if (charData[i] == 1) {\n"
+	"						// todo : other colors\n"
+	"						bitsyDrawPixel(char.color, left + x, top + y);\n"
+	"					}\n"
 	"				}\n"
 	"			}\n"
 	"		}\n"
@@ -2070,15 +2206,87 @@ char* dialog_js =
 	"	};\n"
 	"\n"
 	"	var effectTime = 0; // TODO this variable should live somewhere better\n"
+	"\n"
+	"	// the textbox keeps its pixels between frames: only newly revealed chars are drawn,\n"
+	"	// animated chars are erased and redrawn, and static chars only when an erase hit them\n"
+	"	var drawnPage = null;\n"
+	"	var drawnRevealGeneration = -1;\n"
+	"	var animatedCharCount = 0;\n"
+	"	var arrowRect = null;\n"
+	"\n"
+	"	function overlapsAny(rect, rects) {\n"
+	"		for (var i = 0; i < rects.length; i++) {\n"
+	"			var other = rects[i];\n"
+	"			if (rect.x < other.x + other.w && other.x < rect.x + rect.w &&\n"
+	"				rect.y < other.y + other.h && other.y < rect.y + rect.h) {\n"
+	"				return true;\n"
+	"			}\n"
+	"		}\n"
+	"\n"
+	"		return false;\n"
+	"	}\n"
+	"\n"
+	"	this.UpdateTextbox = function(buffer) {\n"
+	"		var canContinue = buffer.CanContinue();\n"
+	"		var erased = [];\n"
+	"\n"
+	"		buffer.ForEachActiveChar(function(char) {\n"
+	"			if (char.drawnRect != null && char.isAnimated) {\n"
+	"				erased.push(char.drawnRect);\n"
+	"			}\n"
+	"		});\n"
+	"\n"
+	"		if (arrowRect != null && !canContinue) {\n"
+	"			erased.push(arrowRect);\n"
+	"			arrowRect = null;\n"
+	"		}\n"
+	"\n"
+	"		bitsyDrawBegin(1);\n"
+	"		for (var i = 0; i < erased.length; i++) {\n"
+	"			bitsyClear(textBackgroundIndex, erased[i].x, erased[i].y, erased[i].w, erased[i].h);\n"
+	"		}\n"
+	"		bitsyDrawEnd();\n"
+	"\n"
+	"		var drawChar = this.DrawChar;\n"
+	"		animatedCharCount = 0;\n"
+	"\n"
+	"		buffer.ForEachActiveChar(function(char, row, col, leftPos) {\n"
+	"			if (char.drawnRect == null || char.isAnimated || overlapsAny(char.drawnRect, erased)) {\n"
+	"				drawChar(char, row, col, leftPos);\n"
+	"			}\n"
+	"\n"
+	"			if (char.isAnimated) {\n"
+	"				animatedCharCount++;\n"
+	"			}\n"
+	"		});\n"
+	"\n"
+	"		if (canContinue && (arrowRect == null || overlapsAny(arrowRect, erased))) {\n"
+	"			this.DrawNextArrow();\n"
+	"		}\n"
+	"	};\n"
+	"\n"
 	"	this.Draw = function(buffer, dt) {\n"
 	"		effectTime += dt;\n"
 	"\n"
-	"		this.ClearTextbox();\n"
+	"		if (isGlyphTableStale) {\n"
+	"			resetGlyphs();\n"
+	"		}\n"
 	"\n"
-	"		buffer.ForEachActiveChar(this.DrawChar);\n"
+	"		if (buffer.CurPage() !== drawnPage) {\n"
+	"			this.ClearTextbox();\n"
+	"			buffer.ForEachActiveChar(function(char) { char.drawnRect = null; });\n"
+	"			drawnPage = buffer.CurPage();\n"
+	"			drawnRevealGeneration = -1;\n"
+	"			animatedCharCount = 0;\n"
+	"			arrowRect = null;\n"
+	"		}\n"
 	"\n"
-	"		if (buffer.CanContinue()) {\n"
-	"			this.DrawNextArrow();\n"
+	"		var isChanged = buffer.GetRevealGeneration() !== drawnRevealGeneration || animatedCharCount > 0 ||\n"
+	"			buffer.CanContinue() !== (arrowRect != null);\n"
+	"\n"
+	"		if (isChanged) {\n"
+	"			drawnRevealGeneration = buffer.GetRevealGeneration();\n"
+	"			this.UpdateTextbox(buffer);\n"
 	"		}\n"
 	"\n"
 	"		this.DrawTextbox();\n"
@@ -2096,7 +2304,7 @@ char* dialog_js =
 	"\n"
 	"	this.Reset = function() {\n"
 	"		effectTime = 0;\n"
-	"		// TODO - anything else?\n"
+	"		drawnPage = null; // start from a cleared textbox\n"
 	"	}\n"
 	"\n"
 	"	// this.CharsPerRow = function() {\n"
@@ -2114,6 +2322,7 @@ char* dialog_js =
 	"	var nextCharMaxTime = 50; // in milliseconds\n"
 	"	var isDialogReadyToContinue = false;\n"
 	"	var activeTextEffects = [];\n"
+	"	var revealGeneration = 0; // changes whenever the visible chars do\n"
 	"	var font = null;\n"
 	"	var arabicHandler = new ArabicHandler();\n"
 	"	var onDialogEndCallbacks = [];\n"
@@ -2128,6 +2337,7 @@ char* dialog_js =
 	"	this.CurPageCount = function() { return buffer.length; };\n"
 	"	this.CurRowCount = function() { return this.CurPage().length; };\n"
 	"	this.CurCharCount = function() { return this.CurRow().length; };\n"
+	"	this.GetRevealGeneration = function() { return revealGeneration; };\n"
 	"\n"
 	"	this.ForEachActiveChar = function(handler) { // Iterates over visible characters on the active page\n"
 	"		var rowCount = rowIndex + 1;\n"
@@ -2166,6 +2376,7 @@ char* dialog_js =
 	"		rowIndex = 0;\n"
 	"		charIndex = 0;\n"
 	"		isDialogReadyToContinue = false;\n"
+	"		revealGeneration++;\n"
 	"\n"
 	"		afterManualPagebreak = false;\n"
 	"\n"
@@ -2178,6 +2389,7 @@ char* dialog_js =
 	"\n"
 	"	this.DoNextChar = function() {\n"
 	"		nextCharTimer = 0; //reset timer\n"
+	"		revealGeneration++;\n"
 	"\n"
 	"		//time to update characters\n"
 	"		if (charIndex + 1 < this.CurCharCount()) {\n"
@@ -2237,6 +2449,7 @@ char* dialog_js =
 	"		}\n"
 	"		rowIndex = this.CurRowCount()-1;\n"
 	"		charIndex = this.CurCharCount()-1;\n"
+	"		revealGeneration++;\n"
 	"	};\n"
 	"\n"
 	"	this.FlipPage = function() {\n"
@@ -2245,6 +2458,7 @@ char* dialog_js =
 	"		pageIndex++;\n"
 	"		rowIndex = 0;\n"
 	"		charIndex = 0;\n"
+	"		revealGeneration++;\n"
 	"	}\n"
 	"\n"
 	"	this.EndDialog = function() {\n"
@@ -2336,6 +2550,10 @@ char* dialog_js =
 	"		}\n"
 	"\n"
 	"		this.bitmap = [];\n"
+	"		this.glyphKey = null; // bitmaps with the same key are the same glyph\n"
+	"		this.glyphId = -1; // set for chars of baked fonts, which need no upload\n"
+	"		this.isAnimated = hasAnimatedEffect(this.effectList); // redrawn every frame\n"
+	"		this.drawnRect = null; // where the renderer last drew it\n"
 	"		this.width = 0;\n"
 	"		this.height = 0;\n"
 	"		this.base_offset = { // hacky name\n"
@@ -2350,6 +2568,10 @@ char* dialog_js =
 	"\n"
 	"		var charData = font.getChar(char);\n"
 	"		this.bitmap = charData.data;\n"
+	"		this.glyphKey = \"char_\" + char.charCodeAt(0);\n"
+	"		if (charData.glyphId != undefined) {\n"
+	"			this.glyphId = charData.glyphId;\n"
+	"		}\n"
 	"		this.width = charData.width;\n"
 	"		this.height = charData.height;\n"
 	"		this.base_offset.x = charData.offset.x;\n"
@@ -2368,6 +2590,7 @@ char* dialog_js =
 	"		}\n"
 	"\n"
 	"		this.bitmap = drawingDataFlat;\n"
+	"		this.glyphKey = \"drw_\" + drawingId;\n"
 	"		this.width = 8;\n"
 	"		this.height = 8;\n"
 	"		this.spacing = 8;\n"
@@ -2801,6 +3024,25 @@ char* dialog_js =
 	"/* NEW TEXT EFFECTS */\n"
 	"var TextEffects = {};\n"
 	"\n"
+	"// effects that only set a fixed color; anything else (wvy, shk, rbw, effects added by\n"
+	"// hacks) may change every frame\n"
+	"var staticTextEffects = {\n"
+	"	\"clr1\" : true,\n"
+	"	\"clr2\" : true,\n"
+	"	\"clr3\" : true,\n"
+	"	\"_debug_highlight\" : true,\n"
+	"};\n"
+	"\n"
+	"function hasAnimatedEffect(effectList) {\n"
+	"	for (var i = 0; i < effectList.length; i++) {\n"
+	"		if (!staticTextEffects[effectList[i]]) {\n"
+	"			return true;\n"
+	"		}\n"
+	"	}\n"
+	"\n"
+	"	return false;\n"
+	"}\n"
+	"\n"
 	"var RainbowEffect = function() {\n"
 	"	this.DoEffect = function(char, time) {\n"
 	"		char.color = rainbowColorStartIndex + Math.floor(((time / 100) - char.col * 0.5) % rainbowColorCount);\n"
@@ -2900,6 +3142,15 @@ char* font_js =
 	"\n"
 	"this.Get = function(fontName) {\n"
 	"	var fontData = self.GetData(fontName);\n"
+	"\n"
+	"	// fonts without data may be baked into the runtime instead of parsed\n"
+	"	if (fontData == null) {\n"
+	"		var bakedFont = bitsyGetBakedFont(fontName);\n"
+	"		if (bakedFont != null) {\n"
+	"			return new BakedFont(fontName, bakedFont);\n"
+	"		}\n"
+	"	}\n"
+	"\n"
 	"	return self.Create(fontData);\n"
 	"}\n"
 	"\n"
@@ -3070,6 +3321,69 @@ char* font_js =
 	"	parseFont(fontData);\n"
 	"}\n"
 	"\n"
+	"// same interface as Font, backed by the runtime's baked tables: char data is fetched\n"
+	"// on first use and has a glyphId (see bitsyDrawGlyph) in place of the bitmap array\n"
+	"function BakedFont(fontName, bakedFont) {\n"
+	"	var name = fontName;\n"
+	"	var width = bakedFont.width;\n"
+	"	var height = bakedFont.height;\n"
+	"	var chardata = {};\n"
+	"\n"
+	"	var invalidCharData = {\n"
+	"		width: width,\n"
+	"		height: height,\n"
+	"		offset: {\n"
+	"			x: 0,\n"
+	"			y: 0\n"
+	"		},\n"
+	"		spacing: width,\n"
+	"		data: [],\n"
+	"	};\n"
+	"\n"
+	"	for (var y = 0; y < height; y++) {\n"
+	"		for (var x = 0; x < width; x++) {\n"
+	"			invalidCharData.data.push((x < width-1 && y < height-1) ? 1 : 0);\n"
+	"		}\n"
+	"	}\n"
+	"\n"
+	"	function getCharData(codepoint) {\n"
+	"		if (chardata[codepoint] === undefined) {\n"
+	"			chardata[codepoint] = bitsyGetBakedChar(bakedFont.id, codepoint);\n"
+	"		}\n"
+	"\n"
+	"		return chardata[codepoint];\n"
+	"	}\n"
+	"\n"
+	"	this.getName = function() {\n"
+	"		return name;\n"
+	"	}\n"
+	"\n"
+	"	this.getData = function() {\n"
+	"		return chardata;\n"
+	"	}\n"
+	"\n"
+	"	this.getWidth = function() {\n"
+	"		return width;\n"
+	"	}\n"
+	"\n"
+	"	this.getHeight = function() {\n"
+	"		return height;\n"
+	"	}\n"
+	"\n"
+	"	this.hasChar = function(char) {\n"
+	"		return getCharData(char.charCodeAt(0)) != null;\n"
+	"	}\n"
+	"\n"
+	"	this.getChar = function(char) {\n"
+	"		var charData = getCharData(char.charCodeAt(0));\n"
+	"		return charData != null ? charData : invalidCharData;\n"
+	"	}\n"
+	"\n"
+	"	this.allCharCodes = function() {\n"
+	"		return bitsyGetBakedCharCodes(bakedFont.id);\n"
+	"	}\n"
+	"}\n"
+	"\n"
 	"} // FontManager\n";
 
 char* renderer_js =
@@ -3083,6 +3397,8 @@ char* renderer_js =
 	"	render: {},\n"
 	"};\n"
 	"\n"
+	"var cacheGeneration = 0; // tile buffer ids are only valid within one generation\n"
+	"\n"
 	"// var debugRenderCount = 0;\n"
 	"\n"
 	"function createRenderCacheId(drawingId, colorIndex) {\n"
@@ -3117,24 +3433,26 @@ char* renderer_js =
 	"	var backgroundColor = tileColorStartIndex + 0;\n"
 	"	var foregroundColor = tileColorStartIndex + col;\n"
 	"\n"
-	"	bitsyDrawBegin(tileId);\n"
+	"	bitsyDrawTileData(tileId, packDrawingData(drawingData), foregroundColor, backgroundColor);\n"
+	"\n"
+	"	return tileId;\n"
+	"}\n"
+	"\n"
+	"// one byte per row, leftmost pixel in the high bit (the layout bitsyDrawTileData expects)\n"
+	"function packDrawingData(drawingData) {\n"
+	"	var bits = new Uint8Array(tilesize);\n"
 	"\n"
 	"	for (var y = 0; y < tilesize; y++) {\n"
-	"		for (var x = 0; x < tilesize; x++) {\n"
-	"			var px = drawingData[y][x];\n"
+	"		var row = 0;\n"
 	"\n"
-	"			if (px === 1) {\n"
-	"				bitsyDrawPixel(foregroundColor, x, y);\n"
-	"			}\n"
-	"			else {\n"
-	"				bitsyDrawPixel(backgroundColor, x, y);\n"
-	"			}\n"
+	"		for (var x = 0; x < tilesize; x++) {\n"
+	"			row = (row << 1) | (drawingData[y][x] === 1 ? 1 : 0);\n"
 	"		}\n"
-	"	}\n"
 	"\n"
-	"	bitsyDrawEnd();\n"
+	"		bits[y] = row;\n"
+	"	}\n"
 	"\n"
-	"	return tileId;\n"
+	"	return bits;\n"
 	"}\n"
 	"\n"
 	"// TODO : move into core\n"
@@ -3197,6 +3515,11 @@ char* renderer_js =
 	"this.ClearCache = function() {\n"
 	"	bitsyResetTiles();\n"
 	"	drawingCache.render = {};\n"
+	"	cacheGeneration++;\n"
+	"}\n"
+	"\n"
+	"this.GetCacheGeneration = function() {\n"
+	"	return cacheGeneration;\n"
 	"}\n"
 	"\n"
 	"} // Renderer()\n";
@@ -5509,9 +5832,13 @@ char* transition_js =
 	"\n"
 	"	var isTransitioning = false;\n"
 	"	var transitionTime = 0; // milliseconds\n"
-	"	var minStepTime = 125; // cap the frame rate\n"
+	"	var minStepTime = 125; // length of one effect step (effects with a pixelEffectFunc draw once per step)\n"
 	"	var curStep = 0;\n"
 	"\n"
+	"	// native room snapshot handles (see bitsySnapshotRoom)\n"
+	"	var startSnapshot = 0;\n"
+	"	var endSnapshot = 1;\n"
+	"\n"
 	"	this.BeginTransition = function(startRoom, startX, startY, endRoom, endX, endY, effectName) {\n"
 	"		bitsyLog(\"--- START ROOM TRANSITION ---\");\n"
 	"\n"
@@ -5530,9 +5857,8 @@ char* transition_js =
 	"			player().room = \"_transition_none\"; // kind of hacky!!\n"
 	"		}\n"
 	"\n"
-	"		var startRoomPixels = createRoomPixelBuffer(room[startRoom]);\n"
+	"		var startImage = createRoomSnapshot(startSnapshot, room[startRoom]);\n"
 	"		var startPalette = getPal(room[startRoom].pal);\n"
-	"		var startImage = new PostProcessImage(startRoomPixels);\n"
 	"		transitionStart = new TransitionInfo(startImage, startPalette, startX, startY);\n"
 	"\n"
 	"		if (transitionEffects[curEffect].showPlayerEnd) {\n"
@@ -5544,9 +5870,8 @@ char* transition_js =
 	"			player().room = \"_transition_none\";\n"
 	"		}\n"
 	"\n"
-	"		var endRoomPixels = createRoomPixelBuffer(room[endRoom]);\n"
+	"		var endImage = createRoomSnapshot(endSnapshot, room[endRoom]);\n"
 	"		var endPalette = getPal(room[endRoom].pal);\n"
-	"		var endImage = new PostProcessImage(endRoomPixels);\n"
 	"		transitionEnd = new TransitionInfo(endImage, endPalette, endX, endY);\n"
 	"\n"
 	"		isTransitioning = true;\n"
@@ -5568,23 +5893,49 @@ char* transition_js =
 	"\n"
 	"		transitionTime += dt;\n"
 	"\n"
-	"		var maxStep = transitionEffects[curEffect].stepCount;\n"
+	"		var effect = transitionEffects[curEffect];\n"
+	"		var maxStep = effect.stepCount;\n"
+	"\n"
+	"		if (!effect.pixelEffectFunc) {\n"
+	"			// native kernels are cheap enough to draw every frame: delta follows the clock\n"
+	"			// (over the same length as the stepped version) instead of jumping per step\n"
+	"			var delta = Math.min(transitionTime / (maxStep * minStepTime), (maxStep - 1) / maxStep);\n"
+	"\n"
+	"			if (effect.paletteEffectFunc) {\n"
+	"				updatePaletteWithTileColors(effect.paletteEffectFunc(transitionStart, transitionEnd, delta));\n"
+	"			}\n"
+	"\n"
+	"			bitsyDrawBegin(0);\n"
+	"			bitsyDrawTransition(\n"
+	"				curEffect,\n"
+	"				delta,\n"
+	"				transitionStart.Image.Snapshot,\n"
+	"				transitionStart.PlayerCenter.x,\n"
+	"				transitionStart.PlayerCenter.y,\n"
+	"				transitionEnd.Image.Snapshot,\n"
+	"				transitionEnd.PlayerCenter.x,\n"
+	"				transitionEnd.PlayerCenter.y);\n"
+	"			bitsyDrawEnd();\n"
 	"\n"
-	"		if (transitionTime >= minStepTime) {\n"
+	"			if (transitionTime >= (maxStep - 1) * minStepTime) {\n"
+	"				curStep = maxStep - 1;\n"
+	"			}\n"
+	"		}\n"
+	"		else if (transitionTime >= minStepTime) {\n"
 	"			curStep++;\n"
 	"\n"
 	"			var step = curStep;\n"
 	"			bitsyLog(\"transition step \" + step);\n"
 	"\n"
-	"			if (transitionEffects[curEffect].paletteEffectFunc) {\n"
-	"				var colors = transitionEffects[curEffect].paletteEffectFunc(transitionStart, transitionEnd, (step / maxStep));\n"
+	"			if (effect.paletteEffectFunc) {\n"
+	"				var colors = effect.paletteEffectFunc(transitionStart, transitionEnd, (step / maxStep));\n"
 	"				updatePaletteWithTileColors(colors);\n"
 	"			}\n"
 	"\n"
 	"			bitsyDrawBegin(0);\n"
 	"			for (var y = 0; y < 128; y++) {\n"
 	"				for (var x = 0; x < 128; x++) {\n"
-	"					var color = transitionEffects[curEffect].pixelEffectFunc(transitionStart, transitionEnd, x, y, (step / maxStep));\n"
+	"					var color = effect.pixelEffectFunc(transitionStart, transitionEnd, x, y, (step / maxStep));\n"
 	"					bitsyDrawPixel(color, x, y);\n"
 	"				}\n"
 	"			}\n"
@@ -5600,6 +5951,9 @@ char* transition_js =
 	"			transitionEnd = null;\n"
 	"			curStep = 0;\n"
 	"\n"
+	"			bitsyReleaseSnapshot(startSnapshot);\n"
+	"			bitsyReleaseSnapshot(endSnapshot);\n"
+	"\n"
 	"			if (transitionCompleteCallback != null) {\n"
 	"				transitionCompleteCallback();\n"
 	"			}\n"
@@ -5619,6 +5973,8 @@ char* transition_js =
 	"		}\n"
 	"	}\n"
 	"\n"
+	"	// effects without a pixelEffectFunc are drawn by the native kernel of the same\n"
+	"	// name (see bitsyDrawTransition)\n"
 	"	var transitionEffects = {};\n"
 	"	var curEffect = \"none\";\n"
 	"	this.RegisterTransitionEffect = function(name, effect) {\n"
@@ -5636,9 +5992,6 @@ char* transition_js =
 	"		showPlayerStart : false,\n"
 	"		showPlayerEnd : true,\n"
 	"		stepCount : 6,\n"
-	"		pixelEffectFunc : function(start, end, pixelX, pixelY, delta) {\n"
-	"			return delta < 0.5 ? start.Image.GetPixel(pixelX, pixelY) : end.Image.GetPixel(pixelX, pixelY);\n"
-	"		},\n"
 	"		paletteEffectFunc : function(start, end, delta) {\n"
 	"			var colors = [];\n"
 	"\n"
@@ -5665,9 +6018,6 @@ char* transition_js =
 	"		showPlayerStart : false,\n"
 	"		showPlayerEnd : true,\n"
 	"		stepCount : 6,\n"
-	"		pixelEffectFunc : function(start, end, pixelX, pixelY, delta) {\n"
-	"			return delta < 0.5 ? start.Image.GetPixel(pixelX, pixelY) : end.Image.GetPixel(pixelX, pixelY);\n"
-	"		},\n"
 	"		paletteEffectFunc : function(start, end, delta) {\n"
 	"			var colors = [];\n"
 	"\n"
@@ -5694,24 +6044,6 @@ char* transition_js =
 	"		showPlayerStart : true,\n"
 	"		showPlayerEnd : true,\n"
 	"		stepCount : 12,\n"
-	"		pixelEffectFunc : function(start, end, pixelX, pixelY, delta) {\n"
-	"			var waveDelta = delta < 0.5 ? delta / 0.5 : 1 - ((delta - 0.5) / 0.5);\n"
-	"\n"
-	"			var offset = (pixelY + (waveDelta * waveDelta * 0.2 * start.Image.Height));\n"
-	"			var freq = 4;\n"
-	"			var size = 2 + (14 * waveDelta);\n"
-	"			pixelX += Math.floor(Math.sin(offset / freq) * size);\n"
-	"\n"
-	"			if (pixelX < 0) {\n"
-	"				pixelX += start.Image.Width;\n"
-	"			}\n"
-	"			else if (pixelX >= start.Image.Width) {\n"
-	"				pixelX -= start.Image.Width;\n"
-	"			}\n"
-	"\n"
-	"			var curImage = delta < 0.5 ? start.Image : end.Image;\n"
-	"			return curImage.GetPixel(pixelX, pixelY);\n"
-	"		},\n"
 	"		paletteEffectFunc : function(start, end, delta) {\n"
 	"			return delta < 0.5 ? start.Palette : end.Palette;\n"
 	"		},\n"
@@ -5721,39 +6053,6 @@ char* transition_js =
 	"		showPlayerStart : true,\n"
 	"		showPlayerEnd : true,\n"
 	"		stepCount : 12,\n"
-	"		pixelEffectFunc : function(start, end, pixelX, pixelY, delta) {\n"
-	"			if (delta <= 0.4) {\n"
-	"				var tunnelDelta = 1 - (delta / 0.4);\n"
-	"\n"
-	"				var xDist = start.PlayerCenter.x - pixelX;\n"
-	"				var yDist = start.PlayerCenter.y - pixelY;\n"
-	"				var dist = Math.sqrt((xDist * xDist) + (yDist * yDist));\n"
-	"\n"
-	"				if (dist > start.Image.Width * tunnelDelta) {\n"
-	"					return 0;\n"
-	"				}\n"
-	"				else {\n"
-	"					return start.Image.GetPixel(pixelX, pixelY);\n"
-	"				}\n"
-	"			}\n"
-	"			else if (delta <= 0.6) {\n"
-	"				return 0;\n"
-	"			}\n"
-	"			else {\n"
-	"				var tunnelDelta = (delta - 0.6) / 0.4;\n"
-	"\n"
-	"				var xDist = end.PlayerCenter.x - pixelX;\n"
-	"				var yDist = end.PlayerCenter.y - pixelY;\n"
-	"				var dist = Math.sqrt((xDist * xDist) + (yDist * yDist));\n"
-	"\n"
-	"				if (dist > end.Image.Width * tunnelDelta) {\n"
-	"					return 0;\n"
-	"				}\n"
-	"				else {\n"
-	"					return end.Image.GetPixel(pixelX, pixelY);\n"
-	"				}\n"
-	"			}\n"
-	"		},\n"
 	"		paletteEffectFunc : function(start, end, delta) {\n"
 	"			return delta < 0.5 ? start.Palette : end.Palette;\n"
 	"		},\n"
@@ -5790,18 +6089,6 @@ char* transition_js =
 	"		showPlayerStart : false,\n"
 	"		showPlayerEnd : true,\n"
 	"		stepCount : 8,\n"
-	"		pixelEffectFunc : function(start, end, pixelX, pixelY, delta) {\n"
-	"			var pixelOffset = -1 * Math.floor(start.Image.Height * delta);\n"
-	"			var slidePixelY = pixelY + pixelOffset;\n"
-	"\n"
-	"			if (slidePixelY >= 0) {\n"
-	"				return start.Image.GetPixel(pixelX, slidePixelY);\n"
-	"			}\n"
-	"			else {\n"
-	"				slidePixelY += start.Image.Height;\n"
-	"				return end.Image.GetPixel(pixelX, slidePixelY);\n"
-	"			}\n"
-	"		},\n"
 	"		paletteEffectFunc : lerpPalettes,\n"
 	"	});\n"
 	"\n"
@@ -5809,18 +6096,6 @@ char* transition_js =
 	"		showPlayerStart : false,\n"
 	"		showPlayerEnd : true,\n"
 	"		stepCount : 8,\n"
-	"		pixelEffectFunc : function(start, end, pixelX, pixelY, delta) {\n"
-	"			var pixelOffset = Math.floor(start.Image.Height * delta);\n"
-	"			var slidePixelY = pixelY + pixelOffset;\n"
-	"\n"
-	"			if (slidePixelY < start.Image.Height) {\n"
-	"				return start.Image.GetPixel(pixelX, slidePixelY);\n"
-	"			}\n"
-	"			else {\n"
-	"				slidePixelY -= start.Image.Height;\n"
-	"				return end.Image.GetPixel(pixelX, slidePixelY);\n"
-	"			}\n"
-	"		},\n"
 	"		paletteEffectFunc : lerpPalettes,\n"
 	"	});\n"
 	"\n"
@@ -5828,18 +6103,6 @@ char* transition_js =
 	"		showPlayerStart : false,\n"
 	"		showPlayerEnd : true,\n"
 	"		stepCount : 8,\n"
-	"		pixelEffectFunc : function(start, end, pixelX, pixelY, delta) {\n"
-	"			var pixelOffset = -1 * Math.floor(start.Image.Width * delta);\n"
-	"			var slidePixelX = pixelX + pixelOffset;\n"
-	"\n"
-	"			if (slidePixelX >= 0) {\n"
-	"				return start.Image.GetPixel(slidePixelX, pixelY);\n"
-	"			}\n"
-	"			else {\n"
-	"				slidePixelX += start.Image.Width;\n"
-	"				return end.Image.GetPixel(slidePixelX, pixelY);\n"
-	"			}\n"
-	"		},\n"
 	"		paletteEffectFunc : lerpPalettes,\n"
 	"	});\n"
 	"\n"
@@ -5847,86 +6110,29 @@ char* transition_js =
 	"		showPlayerStart : false,\n"
 	"		showPlayerEnd : true,\n"
 	"		stepCount : 8,\n"
-	"		pixelEffectFunc : function(start, end, pixelX, pixelY, delta) {\n"
-	"			var pixelOffset = Math.floor(start.Image.Width * delta);\n"
-	"			var slidePixelX = pixelX + pixelOffset;\n"
-	"\n"
-	"			if (slidePixelX < start.Image.Width) {\n"
-	"				return start.Image.GetPixel(slidePixelX, pixelY);\n"
-	"			}\n"
-	"			else {\n"
-	"				slidePixelX -= start.Image.Width;\n"
-	"				return end.Image.GetPixel(slidePixelX, pixelY);\n"
-	"			}\n"
-	"		},\n"
 	"		paletteEffectFunc : lerpPalettes,\n"
 	"	});\n"
 	"\n"
 	"	// todo : move to Renderer()?\n"
-	"	function createRoomPixelBuffer(room) {\n"
-	"		var pixelBuffer = [];\n"
+	"	function createRoomSnapshot(snapshot, room) {\n"
+	"		// items and sprites as (tile id, x, y), drawn over the room's tiles in order\n"
+	"		var drawTiles = [];\n"
 	"\n"
-	"		for (var i = 0; i < 128 * 128; i++) {\n"
-	"			pixelBuffer.push(tileColorStartIndex);\n"
-	"		}\n"
-	"\n"
-	"		var drawTileInPixelBuffer = function(sourceData, frameIndex, colorIndex, tx, ty, pixelBuffer) {\n"
-	"			var frameData = sourceData[frameIndex];\n"
-	"\n"
-	"			for (var y = 0; y < tilesize; y++) {\n"
-	"				for (var x = 0; x < tilesize; x++) {\n"
-	"					var color = tileColorStartIndex + (frameData[y][x] === 1 ? colorIndex : 0);\n"
-	"					pixelBuffer[(((ty * tilesize) + y) * 128) + ((tx * tilesize) + x)] = color;\n"
-	"				}\n"
-	"			}\n"
-	"		}\n"
-	"\n"
-	"		//draw tiles\n"
-	"		for (i in room.tilemap) {\n"
-	"			for (j in room.tilemap[i]) {\n"
-	"				var id = room.tilemap[i][j];\n"
-	"				var x = parseInt(j);\n"
-	"				var y = parseInt(i);\n"
-	"\n"
-	"				if (id != \"0\" && tile[id] != null) {\n"
-	"					drawTileInPixelBuffer(\n"
-	"						renderer.GetDrawingSource(tile[id].drw),\n"
-	"						tile[id].animation.frameIndex,\n"
-	"						tile[id].col,\n"
-	"						x,\n"
-	"						y,\n"
-	"						pixelBuffer);\n"
-	"				}\n"
-	"			}\n"
-	"		}\n"
-	"\n"
-	"		//draw items\n"
 	"		for (var i = 0; i < room.items.length; i++) {\n"
 	"			var itm = room.items[i];\n"
-	"			drawTileInPixelBuffer(\n"
-	"				renderer.GetDrawingSource(item[itm.id].drw),\n"
-	"				item[itm.id].animation.frameIndex,\n"
-	"				item[itm.id].col,\n"
-	"				itm.x,\n"
-	"				itm.y,\n"
-	"				pixelBuffer);\n"
+	"			drawTiles.push(renderer.GetDrawingFrame(item[itm.id]), itm.x, itm.y);\n"
 	"		}\n"
 	"\n"
-	"		//draw sprites\n"
 	"		for (id in sprite) {\n"
 	"			var spr = sprite[id];\n"
 	"			if (spr.room === room.id) {\n"
-	"				drawTileInPixelBuffer(\n"
-	"					renderer.GetDrawingSource(spr.drw),\n"
-	"					spr.animation.frameIndex,\n"
-	"					spr.col,\n"
-	"					spr.x,\n"
-	"					spr.y,\n"
-	"					pixelBuffer);\n"
+	"				drawTiles.push(renderer.GetDrawingFrame(spr), spr.x, spr.y);\n"
 	"			}\n"
 	"		}\n"
 	"\n"
-	"		return pixelBuffer;\n"
+	"		bitsySnapshotRoom(snapshot, tileColorStartIndex, getRoomTileIds(room), new Uint16Array(drawTiles));\n"
+	"\n"
+	"		return new PostProcessImage(snapshot);\n"
 	"	}\n"
 	"\n"
 	"	function lerpColor(colorA, colorB, t) {\n"
@@ -5939,16 +6145,13 @@ char* transition_js =
 	"}; // TransitionManager()\n"
 	"\n"
 	"// todo : is this wrapper still useful?\n"
-	"var PostProcessImage = function(imageData) {\n"
+	"var PostProcessImage = function(snapshot) {\n"
 	"	this.Width = 128;\n"
 	"	this.Height = 128;\n"
+	"	this.Snapshot = snapshot; // native room snapshot handle\n"
 	"\n"
 	"	this.GetPixel = function(x, y) {\n"
-	"		return imageData[(y * 128) + x];\n"
-	"	};\n"
-	"\n"
-	"	this.GetData = function() {\n"
-	"		return imageData;\n"
+	"		return bitsyGetSnapshotPixel(snapshot, x, y);\n"
 	"	};\n"
 	"};\n"
 	"\n"
@@ -1,2312 +1,403 @@
 #ifndef FONT_H
 #define FONT_H
 
-char* ascii_small_bitsyfont =
-	"FONT ascii_small\n"
-	"SIZE 6 8\n"
-	"CHAR 0\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"CHAR 1\n"
-	"001110\n"
-	"010001\n"
-	"011011\n"
-	"010001\n"
-	"010101\n"
-	"010001\n"
-	"001110\n"
-	"000000\n"
-	"CHAR 2\n"
-	"001110\n"
-	"011111\n"
-	"010101\n"
-	"011111\n"
-	"010001\n"
-	"011111\n"
-	"001110\n"
-	"000000\n"
-	"CHAR 3\n"
-	"000000\n"
-	"001010\n"
-	"011111\n"
-	"011111\n"
-	"011111\n"
-	"001110\n"
-	"000100\n"
-	"000000\n"
-	"CHAR 4\n"
-	"000000\n"
-	"000000\n"
-	"001010\n"
-	"001110\n"
-	"001110\n"
-	"000100\n"
-	"000000\n"
-	"000000\n"
-	"CHAR 5\n"
-	"000100\n"
-	"001110\n"
-	"001110\n"
-	"000100\n"
-	"011111\n"
-	"011111\n"
-	"000100\n"
-	"000000\n"
-	"CHAR 6\n"
-	"000000\n"
-	"000100\n"
-	"001110\n"
-	"011111\n"
-	"011111\n"
-	"000100\n"
-	"001110\n"
-	"000000\n"
-	"CHAR 7\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"001100\n"
-	"001100\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"CHAR 8\n"
-	"111111\n"
-	"111111\n"
-	"111111\n"
-	"110011\n"
-	"110011\n"
-	"111111\n"
-	"111111\n"
-	"111111\n"
-	"CHAR 9\n"
-	"000000\n"
-	"000000\n"
-	"011110\n"
-	"010010\n"
-	"010010\n"
-	"011110\n"
-	"000000\n"
-	"000000\n"
-	"CHAR 10\n"
-	"111111\n"
-	"111111\n"
-	"100001\n"
-	"101101\n"
-	"101101\n"
-	"100001\n"
-	"111111\n"
-	"111111\n"
-	"CHAR 11\n"
-	"000000\n"
-	"000111\n"
-	"000011\n"
-	"001101\n"
-	"010010\n"
-	"010010\n"
-	"001100\n"
-	"000000\n"
-	"CHAR 12\n"
-	"001110\n"
-	"010001\n"
-	"010001\n"
-	"001110\n"
-	"000100\n"
-	"001110\n"
-	"000100\n"
-	"000000\n"
-	"CHAR 13\n"
-	"000100\n"
-	"000110\n"
-	"000101\n"
-	"000100\n"
-	"001100\n"
-	"011100\n"
-	"011000\n"
-	"000000\n"
-	"CHAR 14\n"
-	"000011\n"
-	"001101\n"
-	"001011\n"
-	"001101\n"
-	"001011\n"
-	"011011\n"
-	"011000\n"
-	"000000\n"
-	"CHAR 15\n"
-	"000000\n"
-	"010101\n"
-	"001110\n"
-	"011011\n"
-	"001110\n"
-	"010101\n"
-	"000000\n"
-	"000000\n"
-	"CHAR 16\n"
-	"001000\n"
-	"001100\n"
-	"001110\n"
-	"001111\n"
-	"001110\n"
-	"001100\n"
-	"001000\n"
-	"000000\n"
-	"CHAR 17\n"
-	"000010\n"
-	"000110\n"
-	"001110\n"
-	"011110\n"
-	"001110\n"
-	"000110\n"
-	"000010\n"
-	"000000\n"
-	"CHAR 18\n"
-	"000100\n"
-	"001110\n"
-	"011111\n"
-	"000100\n"
-	"011111\n"
-	"001110\n"
-	"000100\n"
-	"000000\n"
-	"CHAR 19\n"
-	"001010\n"
-	"001010\n"
-	"001010\n"
-	"001010\n"
-	"001010\n"
-	"000000\n"
-	"001010\n"
-	"000000\n"
-	"CHAR 20\n"
-	"001111\n"
-	"010101\n"
-	"010101\n"
-	"001101\n"
-	"000101\n"
-	"000101\n"
-	"000101\n"
-	"000000\n"
-	"CHAR 21\n"
-	"001110\n"
-	"010001\n"
-	"001100\n"
-	"001010\n"
-	"000110\n"
-	"010001\n"
-	"001110\n"
-	"000000\n"
-	"CHAR 22\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"011110\n"
-	"011110\n"
-	"000000\n"
-	"CHAR 23\n"
-	"000100\n"
-	"001110\n"
-	"011111\n"
-	"000100\n"
-	"011111\n"
-	"001110\n"
-	"000100\n"
-	"001110\n"
-	"CHAR 24\n"
-	"000100\n"
-	"001110\n"
-	"011111\n"
-	"000100\n"
-	"000100\n"
-	"000100\n"
-	"000100\n"
-	"000000\n"
-	"CHAR 25\n"
-	"000100\n"
-	"000100\n"
-	"000100\n"
-	"000100\n"
-	"011111\n"
-	"001110\n"
-	"000100\n"
-	"000000\n"
-	"CHAR 26\n"
-	"000000\n"
-	"000100\n"
-	"000110\n"
-	"011111\n"
-	"000110\n"
-	"000100\n"
-	"000000\n"
-	"000000\n"
-	"CHAR 27\n"
-	"000000\n"
-	"000100\n"
-	"001100\n"
-	"011111\n"
-	"001100\n"
-	"000100\n"
-	"000000\n"
-	"000000\n"
-	"CHAR 28\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"010000\n"
-	"010000\n"
-	"010000\n"
-	"011111\n"
-	"000000\n"
-	"CHAR 29\n"
-	"000000\n"
-	"001010\n"
-	"001010\n"
-	"011111\n"
-	"001010\n"
-	"001010\n"
-	"000000\n"
-	"000000\n"
-	"CHAR 30\n"
-	"000100\n"
-	"000100\n"
-	"001110\n"
-	"001110\n"
-	"011111\n"
-	"011111\n"
-	"000000\n"
-	"000000\n"
-	"CHAR 31\n"
-	"011111\n"
-	"011111\n"
-	"001110\n"
-	"001110\n"
-	"000100\n"
-	"000100\n"
-	"000000\n"
-	"000000\n"
-	"CHAR 32\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"CHAR 33\n"
-	"000100\n"
-	"001110\n"
-	"001110\n"
-	"000100\n"
-	"000100\n"
-	"000000\n"
-	"000100\n"
-	"000000\n"
-	"CHAR 34\n"
-	"011011\n"
-	"011011\n"
-	"010010\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"CHAR 35\n"
-	"000000\n"
-	"001010\n"
-	"011111\n"
-	"001010\n"
-	"001010\n"
-	"011111\n"
-	"001010\n"
-	"000000\n"
-	"CHAR 36\n"
-	"001000\n"
-	"001110\n"
-	"010000\n"
-	"001100\n"
-	"000010\n"
-	"011100\n"
-	"000100\n"
-	"000000\n"
-	"CHAR 37\n"
-	"011001\n"
-	"011001\n"
-	"000010\n"
-	"000100\n"
-	"001000\n"
-	"010011\n"
-	"010011\n"
-	"000000\n"
-	"CHAR 38\n"
-	"001000\n"
-	"010100\n"
-	"010100\n"
-	"001000\n"
-	"010101\n"
-	"010010\n"
-	"001101\n"
-	"000000\n"
-	"CHAR 39\n"
-	"001100\n"
-	"001100\n"
-	"001000\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"CHAR 40\n"
-	"000100\n"
-	"001000\n"
-	"001000\n"
-	"001000\n"
-	"001000\n"
-	"001000\n"
-	"000100\n"
-	"000000\n"
-	"CHAR 41\n"
-	"001000\n"
-	"000100\n"
-	"000100\n"
-	"000100\n"
-	"000100\n"
-	"000100\n"
-	"001000\n"
-	"000000\n"
-	"CHAR 42\n"
-	"000000\n"
-	"001010\n"
-	"001110\n"
-	"011111\n"
-	"001110\n"
-	"001010\n"
-	"000000\n"
-	"000000\n"
-	"CHAR 43\n"
-	"000000\n"
-	"000100\n"
-	"000100\n"
-	"011111\n"
-	"000100\n"
-	"000100\n"
-	"000000\n"
-	"000000\n"
-	"CHAR 44\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"001100\n"
-	"001100\n"
-	"001000\n"
-	"CHAR 45\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"011111\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"CHAR 46\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"001100\n"
-	"001100\n"
-	"000000\n"
-	"CHAR 47\n"
-	"000000\n"
-	"000001\n"
-	"000010\n"
-	"000100\n"
-	"001000\n"
-	"010000\n"
-	"000000\n"
-	"000000\n"
-	"CHAR 48\n"
-	"001110\n"
-	"010001\n"
-	"010011\n"
-	"010101\n"
-	"011001\n"
-	"010001\n"
-	"001110\n"
-	"000000\n"
-	"CHAR 49\n"
-	"000100\n"
-	"001100\n"
-	"000100\n"
-	"000100\n"
-	"000100\n"
-	"000100\n"
-	"001110\n"
-	"000000\n"
-	"CHAR 50\n"
-	"001110\n"
-	"010001\n"
-	"000001\n"
-	"000110\n"
-	"001000\n"
-	"010000\n"
-	"011111\n"
-	"000000\n"
-	"CHAR 51\n"
-	"001110\n"
-	"010001\n"
-	"000001\n"
-	"001110\n"
-	"000001\n"
-	"010001\n"
-	"001110\n"
-	"000000\n"
-	"CHAR 52\n"
-	"000010\n"
-	"000110\n"
-	"001010\n"
-	"010010\n"
-	"011111\n"
-	"000010\n"
-	"000010\n"
-	"000000\n"
-	"CHAR 53\n"
-	"011111\n"
-	"010000\n"
-	"010000\n"
-	"011110\n"
-	"000001\n"
-	"010001\n"
-	"001110\n"
-	"000000\n"
-	"CHAR 54\n"
-	"000110\n"
-	"001000\n"
-	"010000\n"
-	"011110\n"
-	"010001\n"
-	"010001\n"
-	"001110\n"
-	"000000\n"
-	"CHAR 55\n"
-	"011111\n"
-	"000001\n"
-	"000010\n"
-	"000100\n"
-	"001000\n"
-	"001000\n"
-	"001000\n"
-	"000000\n"
-	"CHAR 56\n"
-	"001110\n"
-	"010001\n"
-	"010001\n"
-	"001110\n"
-	"010001\n"
-	"010001\n"
-	"001110\n"
-	"000000\n"
-	"CHAR 57\n"
-	"001110\n"
-	"010001\n"
-	"010001\n"
-	"001111\n"
-	"000001\n"
-	"000010\n"
-	"001100\n"
-	"000000\n"
-	"CHAR 58\n"
-	"000000\n"
-	"000000\n"
-	"001100\n"
-	"001100\n"
-	"000000\n"
-	"001100\n"
-	"001100\n"
-	"000000\n"
-	"CHAR 59\n"
-	"000000\n"
-	"000000\n"
-	"001100\n"
-	"001100\n"
-	"000000\n"
-	"001100\n"
-	"001100\n"
-	"001000\n"
-	"CHAR 60\n"
-	"000010\n"
-	"000100\n"
-	"001000\n"
-	"010000\n"
-	"001000\n"
-	"000100\n"
-	"000010\n"
-	"000000\n"
-	"CHAR 61\n"
-	"000000\n"
-	"000000\n"
-	"011111\n"
-	"000000\n"
-	"000000\n"
-	"011111\n"
-	"000000\n"
-	"000000\n"
-	"CHAR 62\n"
-	"001000\n"
-	"000100\n"
-	"000010\n"
-	"000001\n"
-	"000010\n"
-	"000100\n"
-	"001000\n"
-	"000000\n"
-	"CHAR 63\n"
-	"001110\n"
-	"010001\n"
-	"000001\n"
-	"000110\n"
-	"000100\n"
-	"000000\n"
-	"000100\n"
-	"000000\n"
-	"CHAR 64\n"
-	"001110\n"
-	"010001\n"
-	"010111\n"
-	"010101\n"
-	"010111\n"
-	"010000\n"
-	"001110\n"
-	"000000\n"
-	"CHAR 65\n"
-	"001110\n"
-	"010001\n"
-	"010001\n"
-	"010001\n"
-	"011111\n"
-	"010001\n"
-	"010001\n"
-	"000000\n"
-	"CHAR 66\n"
-	"011110\n"
-	"010001\n"
-	"010001\n"
-	"011110\n"
-	"010001\n"
-	"010001\n"
-	"011110\n"
-	"000000\n"
-	"CHAR 67\n"
-	"001110\n"
-	"010001\n"
-	"010000\n"
-	"010000\n"
-	"010000\n"
-	"010001\n"
-	"001110\n"
-	"000000\n"
-	"CHAR 68\n"
-	"011110\n"
-	"010001\n"
-	"010001\n"
-	"010001\n"
-	"010001\n"
-	"010001\n"
-	"011110\n"
-	"000000\n"
-	"CHAR 69\n"
-	"011111\n"
-	"010000\n"
-	"010000\n"
-	"011110\n"
-	"010000\n"
-	"010000\n"
-	"011111\n"
-	"000000\n"
-	"CHAR 70\n"
-	"011111\n"
-	"010000\n"
-	"010000\n"
-	"011110\n"
-	"010000\n"
-	"010000\n"
-	"010000\n"
-	"000000\n"
-	"CHAR 71\n"
-	"001110\n"
-	"010001\n"
-	"010000\n"
-	"010111\n"
-	"010001\n"
-	"010001\n"
-	"001111\n"
-	"000000\n"
-	"CHAR 72\n"
-	"010001\n"
-	"010001\n"
-	"010001\n"
-	"011111\n"
-	"010001\n"
-	"010001\n"
-	"010001\n"
-	"000000\n"
-	"CHAR 73\n"
-	"001110\n"
-	"000100\n"
-	"000100\n"
-	"000100\n"
-	"000100\n"
-	"000100\n"
-	"001110\n"
-	"000000\n"
-	"CHAR 74\n"
-	"000001\n"
-	"000001\n"
-	"000001\n"
-	"000001\n"
-	"010001\n"
-	"010001\n"
-	"001110\n"
-	"000000\n"
-	"CHAR 75\n"
-	"010001\n"
-	"010010\n"
-	"010100\n"
-	"011000\n"
-	"010100\n"
-	"010010\n"
-	"010001\n"
-	"000000\n"
-	"CHAR 76\n"
-	"010000\n"
-	"010000\n"
-	"010000\n"
-	"010000\n"
-	"010000\n"
-	"010000\n"
-	"011111\n"
-	"000000\n"
-	"CHAR 77\n"
-	"010001\n"
-	"011011\n"
-	"010101\n"
-	"010001\n"
-	"010001\n"
-	"010001\n"
-	"010001\n"
-	"000000\n"
-	"CHAR 78\n"
-	"010001\n"
-	"011001\n"
-	"010101\n"
-	"010011\n"
-	"010001\n"
-	"010001\n"
-	"010001\n"
-	"000000\n"
-	"CHAR 79\n"
-	"001110\n"
-	"010001\n"
-	"010001\n"
-	"010001\n"
-	"010001\n"
-	"010001\n"
-	"001110\n"
-	"000000\n"
-	"CHAR 80\n"
-	"011110\n"
-	"010001\n"
-	"010001\n"
-	"011110\n"
-	"010000\n"
-	"010000\n"
-	"010000\n"
-	"000000\n"
-	"CHAR 81\n"
-	"001110\n"
-	"010001\n"
-	"010001\n"
-	"010001\n"
-	"010101\n"
-	"010010\n"
-	"001101\n"
-	"000000\n"
-	"CHAR 82\n"
-	"011110\n"
-	"010001\n"
-	"010001\n"
-	"011110\n"
-	"010010\n"
-	"010001\n"
-	"010001\n"
-	"000000\n"
-	"CHAR 83\n"
-	"001110\n"
-	"010001\n"
-	"010000\n"
-	"001110\n"
-	"000001\n"
-	"010001\n"
-	"001110\n"
-	"000000\n"
-	"CHAR 84\n"
-	"011111\n"
-	"000100\n"
-	"000100\n"
-	"000100\n"
-	"000100\n"
-	"000100\n"
-	"000100\n"
-	"000000\n"
-	"CHAR 85\n"
-	"010001\n"
-	"010001\n"
-	"010001\n"
-	"010001\n"
-	"010001\n"
-	"010001\n"
-	"001110\n"
-	"000000\n"
-	"CHAR 86\n"
-	"010001\n"
-	"010001\n"
-	"010001\n"
-	"010001\n"
-	"010001\n"
-	"001010\n"
-	"000100\n"
-	"000000\n"
-	"CHAR 87\n"
-	"010001\n"
-	"010001\n"
-	"010101\n"
-	"010101\n"
-	"010101\n"
-	"010101\n"
-	"001010\n"
-	"000000\n"
-	"CHAR 88\n"
-	"010001\n"
-	"010001\n"
-	"001010\n"
-	"000100\n"
-	"001010\n"
-	"010001\n"
-	"010001\n"
-	"000000\n"
-	"CHAR 89\n"
-	"010001\n"
-	"010001\n"
-	"010001\n"
-	"001010\n"
-	"000100\n"
-	"000100\n"
-	"000100\n"
-	"000000\n"
-	"CHAR 90\n"
-	"011110\n"
-	"000010\n"
-	"000100\n"
-	"001000\n"
-	"010000\n"
-	"010000\n"
-	"011110\n"
-	"000000\n"
-	"CHAR 91\n"
-	"001110\n"
-	"001000\n"
-	"001000\n"
-	"001000\n"
-	"001000\n"
-	"001000\n"
-	"001110\n"
-	"000000\n"
-	"CHAR 92\n"
-	"000000\n"
-	"010000\n"
-	"001000\n"
-	"000100\n"
-	"000010\n"
-	"000001\n"
-	"000000\n"
-	"000000\n"
-	"CHAR 93\n"
-	"001110\n"
-	"000010\n"
-	"000010\n"
-	"000010\n"
-	"000010\n"
-	"000010\n"
-	"001110\n"
-	"000000\n"
-	"CHAR 94\n"
-	"000100\n"
-	"001010\n"
-	"010001\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"CHAR 95\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"111111\n"
-	"CHAR 96\n"
-	"001100\n"
-	"001100\n"
-	"000100\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"CHAR 97\n"
-	"000000\n"
-	"000000\n"
-	"001110\n"
-	"000001\n"
-	"001111\n"
-	"010001\n"
-	"001111\n"
-	"000000\n"
-	"CHAR 98\n"
-	"010000\n"
-	"010000\n"
-	"011110\n"
-	"010001\n"
-	"010001\n"
-	"010001\n"
-	"011110\n"
-	"000000\n"
-	"CHAR 99\n"
-	"000000\n"
-	"000000\n"
-	"001110\n"
-	"010001\n"
-	"010000\n"
-	"010001\n"
-	"001110\n"
-	"000000\n"
-	"CHAR 100\n"
-	"000001\n"
-	"000001\n"
-	"001111\n"
-	"010001\n"
-	"010001\n"
-	"010001\n"
-	"001111\n"
-	"000000\n"
-	"CHAR 101\n"
-	"000000\n"
-	"000000\n"
-	"001110\n"
-	"010001\n"
-	"011110\n"
-	"010000\n"
-	"001110\n"
-	"000000\n"
-	"CHAR 102\n"
-	"000110\n"
-	"001000\n"
-	"001000\n"
-	"011110\n"
-	"001000\n"
-	"001000\n"
-	"001000\n"
-	"000000\n"
-	"CHAR 103\n"
-	"000000\n"
-	"000000\n"
-	"001111\n"
-	"010001\n"
-	"010001\n"
-	"001111\n"
-	"000001\n"
-	"001110\n"
-	"CHAR 104\n"
-	"010000\n"
-	"010000\n"
-	"011100\n"
-	"010010\n"
-	"010010\n"
-	"010010\n"
-	"010010\n"
-	"000000\n"
-	"CHAR 105\n"
-	"000100\n"
-	"000000\n"
-	"000100\n"
-	"000100\n"
-	"000100\n"
-	"000100\n"
-	"000110\n"
-	"000000\n"
-	"CHAR 106\n"
-	"000010\n"
-	"000000\n"
-	"000110\n"
-	"000010\n"
-	"000010\n"
-	"000010\n"
-	"010010\n"
-	"001100\n"
-	"CHAR 107\n"
-	"010000\n"
-	"010000\n"
-	"010010\n"
-	"010100\n"
-	"011000\n"
-	"010100\n"
-	"010010\n"
-	"000000\n"
-	"CHAR 108\n"
-	"000100\n"
-	"000100\n"
-	"000100\n"
-	"000100\n"
-	"000100\n"
-	"000100\n"
-	"000110\n"
-	"000000\n"
-	"CHAR 109\n"
-	"000000\n"
-	"000000\n"
-	"011010\n"
-	"010101\n"
-	"010101\n"
-	"010001\n"
-	"010001\n"
-	"000000\n"
-	"CHAR 110\n"
-	"000000\n"
-	"000000\n"
-	"011100\n"
-	"010010\n"
-	"010010\n"
-	"010010\n"
-	"010010\n"
-	"000000\n"
-	"CHAR 111\n"
-	"000000\n"
-	"000000\n"
-	"001110\n"
-	"010001\n"
-	"010001\n"
-	"010001\n"
-	"001110\n"
-	"000000\n"
-	"CHAR 112\n"
-	"000000\n"
-	"000000\n"
-	"011110\n"
-	"010001\n"
-	"010001\n"
-	"010001\n"
-	"011110\n"
-	"010000\n"
-	"CHAR 113\n"
-	"000000\n"
-	"000000\n"
-	"001111\n"
-	"010001\n"
-	"010001\n"
-	"010001\n"
-	"001111\n"
-	"000001\n"
-	"CHAR 114\n"
-	"000000\n"
-	"000000\n"
-	"010110\n"
-	"001001\n"
-	"001000\n"
-	"001000\n"
-	"011100\n"
-	"000000\n"
-	"CHAR 115\n"
-	"000000\n"
-	"000000\n"
-	"001110\n"
-	"010000\n"
-	"001110\n"
-	"000001\n"
-	"001110\n"
-	"000000\n"
-	"CHAR 116\n"
-	"000000\n"
-	"001000\n"
-	"011110\n"
-	"001000\n"
-	"001000\n"
-	"001010\n"
-	"000100\n"
-	"000000\n"
-	"CHAR 117\n"
-	"000000\n"
-	"000000\n"
-	"010010\n"
-	"010010\n"
-	"010010\n"
-	"010110\n"
-	"001010\n"
-	"000000\n"
-	"CHAR 118\n"
-	"000000\n"
-	"000000\n"
-	"010001\n"
-	"010001\n"
-	"010001\n"
-	"001010\n"
-	"000100\n"
-	"000000\n"
-	"CHAR 119\n"
-	"000000\n"
-	"000000\n"
-	"010001\n"
-	"010001\n"
-	"010101\n"
-	"011111\n"
-	"001010\n"
-	"000000\n"
-	"CHAR 120\n"
-	"000000\n"
-	"000000\n"
-	"010010\n"
-	"010010\n"
-	"001100\n"
-	"010010\n"
-	"010010\n"
-	"000000\n"
-	"CHAR 121\n"
-	"000000\n"
-	"000000\n"
-	"010010\n"
-	"010010\n"
-	"010010\n"
-	"001110\n"
-	"000100\n"
-	"011000\n"
-	"CHAR 122\n"
-	"000000\n"
-	"000000\n"
-	"011110\n"
-	"000010\n"
-	"001100\n"
-	"010000\n"
-	"011110\n"
-	"000000\n"
-	"CHAR 123\n"
-	"000110\n"
-	"001000\n"
-	"001000\n"
-	"011000\n"
-	"001000\n"
-	"001000\n"
-	"000110\n"
-	"000000\n"
-	"CHAR 124\n"
-	"000100\n"
-	"000100\n"
-	"000100\n"
-	"000100\n"
-	"000100\n"
-	"000100\n"
-	"000100\n"
-	"000100\n"
-	"CHAR 125\n"
-	"001100\n"
-	"000010\n"
-	"000010\n"
-	"000011\n"
-	"000010\n"
-	"000010\n"
-	"001100\n"
-	"000000\n"
-	"CHAR 126\n"
-	"001010\n"
-	"010100\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"CHAR 127\n"
-	"000100\n"
-	"001110\n"
-	"011011\n"
-	"010001\n"
-	"010001\n"
-	"011111\n"
-	"000000\n"
-	"000000\n"
-	"CHAR 128\n"
-	"001110\n"
-	"010001\n"
-	"010000\n"
-	"010000\n"
-	"010001\n"
-	"001110\n"
-	"000100\n"
-	"001100\n"
-	"CHAR 129\n"
-	"010010\n"
-	"000000\n"
-	"010010\n"
-	"010010\n"
-	"010010\n"
-	"010110\n"
-	"001010\n"
-	"000000\n"
-	"CHAR 130\n"
-	"000011\n"
-	"000000\n"
-	"001110\n"
-	"010001\n"
-	"011110\n"
-	"010000\n"
-	"001110\n"
-	"000000\n"
-	"CHAR 131\n"
-	"001110\n"
-	"000000\n"
-	"001110\n"
-	"000001\n"
-	"001111\n"
-	"010001\n"
-	"001111\n"
-	"000000\n"
-	"CHAR 132\n"
-	"001010\n"
-	"000000\n"
-	"001110\n"
-	"000001\n"
-	"001111\n"
-	"010001\n"
-	"001111\n"
-	"000000\n"
-	"CHAR 133\n"
-	"001100\n"
-	"000000\n"
-	"001110\n"
-	"000001\n"
-	"001111\n"
-	"010001\n"
-	"001111\n"
-	"000000\n"
-	"CHAR 134\n"
-	"001110\n"
-	"001010\n"
-	"001110\n"
-	"000001\n"
-	"001111\n"
-	"010001\n"
-	"001111\n"
-	"000000\n"
-	"CHAR 135\n"
-	"000000\n"
-	"001110\n"
-	"010001\n"
-	"010000\n"
-	"010001\n"
-	"001110\n"
-	"000100\n"
-	"001100\n"
-	"CHAR 136\n"
-	"001110\n"
-	"000000\n"
-	"001110\n"
-	"010001\n"
-	"011110\n"
-	"010000\n"
-	"001110\n"
-	"000000\n"
-	"CHAR 137\n"
-	"001010\n"
-	"000000\n"
-	"001110\n"
-	"010001\n"
-	"011110\n"
-	"010000\n"
-	"001110\n"
-	"000000\n"
-	"CHAR 138\n"
-	"001100\n"
-	"000000\n"
-	"001110\n"
-	"010001\n"
-	"011110\n"
-	"010000\n"
-	"001110\n"
-	"000000\n"
-	"CHAR 139\n"
-	"001010\n"
-	"000000\n"
-	"000100\n"
-	"000100\n"
-	"000100\n"
-	"000100\n"
-	"000110\n"
-	"000000\n"
-	"CHAR 140\n"
-	"000100\n"
-	"001010\n"
-	"000000\n"
-	"000100\n"
-	"000100\n"
-	"000100\n"
-	"000110\n"
-	"000000\n"
-	"CHAR 141\n"
-	"001000\n"
-	"000000\n"
-	"000100\n"
-	"000100\n"
-	"000100\n"
-	"000100\n"
-	"000110\n"
-	"000000\n"
-	"CHAR 142\n"
-	"001010\n"
-	"000000\n"
-	"000100\n"
-	"001010\n"
-	"010001\n"
-	"011111\n"
-	"010001\n"
-	"000000\n"
-	"CHAR 143\n"
-	"001110\n"
-	"001010\n"
-	"001110\n"
-	"011011\n"
-	"010001\n"
-	"011111\n"
-	"010001\n"
-	"000000\n"
-	"CHAR 144\n"
-	"000011\n"
-	"000000\n"
-	"011111\n"
-	"010000\n"
-	"011110\n"
-	"010000\n"
-	"011111\n"
-	"000000\n"
-	"CHAR 145\n"
-	"000000\n"
-	"000000\n"
-	"011110\n"
-	"000101\n"
-	"011111\n"
-	"010100\n"
-	"001111\n"
-	"000000\n"
-	"CHAR 146\n"
-	"001111\n"
-	"010100\n"
-	"010100\n"
-	"011111\n"
-	"010100\n"
-	"010100\n"
-	"010111\n"
-	"000000\n"
-	"CHAR 147\n"
-	"001110\n"
-	"000000\n"
-	"001100\n"
-	"010010\n"
-	"010010\n"
-	"010010\n"
-	"001100\n"
-	"000000\n"
-	"CHAR 148\n"
-	"001010\n"
-	"000000\n"
-	"001100\n"
-	"010010\n"
-	"010010\n"
-	"010010\n"
-	"001100\n"
-	"000000\n"
-	"CHAR 149\n"
-	"011000\n"
-	"000000\n"
-	"001100\n"
-	"010010\n"
-	"010010\n"
-	"010010\n"
-	"001100\n"
-	"000000\n"
-	"CHAR 150\n"
-	"001110\n"
-	"000000\n"
-	"010010\n"
-	"010010\n"
-	"010010\n"
-	"010110\n"
-	"001010\n"
-	"000000\n"
-	"CHAR 151\n"
-	"011000\n"
-	"000000\n"
-	"010010\n"
-	"010010\n"
-	"010010\n"
-	"010110\n"
-	"001010\n"
-	"000000\n"
-	"CHAR 152\n"
-	"001010\n"
-	"000000\n"
-	"010010\n"
-	"010010\n"
-	"010010\n"
-	"001110\n"
-	"000100\n"
-	"011000\n"
-	"CHAR 153\n"
-	"010010\n"
-	"001100\n"
-	"010010\n"
-	"010010\n"
-	"010010\n"
-	"010010\n"
-	"001100\n"
-	"000000\n"
-	"CHAR 154\n"
-	"001010\n"
-	"000000\n"
-	"010010\n"
-	"010010\n"
-	"010010\n"
-	"010010\n"
-	"001100\n"
-	"000000\n"
-	"CHAR 155\n"
-	"000000\n"
-	"000100\n"
-	"001110\n"
-	"010000\n"
-	"010000\n"
-	"001110\n"
-	"000100\n"
-	"000000\n"
-	"CHAR 156\n"
-	"000110\n"
-	"001001\n"
-	"001000\n"
-	"011110\n"
-	"001000\n"
-	"001001\n"
-	"010111\n"
-	"000000\n"
-	"CHAR 157\n"
-	"010001\n"
-	"001010\n"
-	"000100\n"
-	"011111\n"
-	"000100\n"
-	"011111\n"
-	"000100\n"
-	"000000\n"
-	"CHAR 158\n"
-	"011000\n"
-	"010100\n"
-	"010100\n"
-	"011010\n"
-	"010111\n"
-	"010010\n"
-	"010010\n"
-	"000000\n"
-	"CHAR 159\n"
-	"000010\n"
-	"000101\n"
-	"000100\n"
-	"001110\n"
-	"000100\n"
-	"000100\n"
-	"010100\n"
-	"001000\n"
-	"CHAR 160\n"
-	"000110\n"
-	"000000\n"
-	"001110\n"
-	"000001\n"
-	"001111\n"
-	"010001\n"
-	"001111\n"
-	"000000\n"
-	"CHAR 161\n"
-	"000110\n"
-	"000000\n"
-	"000100\n"
-	"000100\n"
-	"000100\n"
-	"000100\n"
-	"000110\n"
-	"000000\n"
-	"CHAR 162\n"
-	"000110\n"
-	"000000\n"
-	"001100\n"
-	"010010\n"
-	"010010\n"
-	"010010\n"
-	"001100\n"
-	"000000\n"
-	"CHAR 163\n"
-	"000110\n"
-	"000000\n"
-	"010010\n"
-	"010010\n"
-	"010010\n"
-	"010110\n"
-	"001010\n"
-	"000000\n"
-	"CHAR 164\n"
-	"001010\n"
-	"010100\n"
-	"000000\n"
-	"011100\n"
-	"010010\n"
-	"010010\n"
-	"010010\n"
-	"000000\n"
-	"CHAR 165\n"
-	"001010\n"
-	"010100\n"
-	"000000\n"
-	"010010\n"
-	"011010\n"
-	"010110\n"
-	"010010\n"
-	"000000\n"
-	"CHAR 166\n"
-	"001110\n"
-	"000001\n"
-	"001111\n"
-	"010001\n"
-	"001111\n"
-	"000000\n"
-	"001111\n"
-	"000000\n"
-	"CHAR 167\n"
-	"001100\n"
-	"010010\n"
-	"010010\n"
-	"010010\n"
-	"001100\n"
-	"000000\n"
-	"011110\n"
-	"000000\n"
-	"CHAR 168\n"
-	"000100\n"
-	"000000\n"
-	"000100\n"
-	"001100\n"
-	"010000\n"
-	"010001\n"
-	"001110\n"
-	"000000\n"
-	"CHAR 169\n"
-	"000000\n"
-	"000000\n"
-	"011111\n"
-	"010000\n"
-	"010000\n"
-	"010000\n"
-	"000000\n"
-	"000000\n"
-	"CHAR 170\n"
-	"000000\n"
-	"000000\n"
-	"111111\n"
-	"000001\n"
-	"000001\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"CHAR 171\n"
-	"010000\n"
-	"010010\n"
-	"010100\n"
-	"001110\n"
-	"010001\n"
-	"000010\n"
-	"000111\n"
-	"000000\n"
-	"CHAR 172\n"
-	"010000\n"
-	"010010\n"
-	"010100\n"
-	"001011\n"
-	"010101\n"
-	"000111\n"
-	"000001\n"
-	"000000\n"
-	"CHAR 173\n"
-	"000100\n"
-	"000000\n"
-	"000100\n"
-	"000100\n"
-	"001110\n"
-	"001110\n"
-	"000100\n"
-	"000000\n"
-	"CHAR 174\n"
-	"000000\n"
-	"000000\n"
-	"001001\n"
-	"010010\n"
-	"001001\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"CHAR 175\n"
-	"000000\n"
-	"000000\n"
-	"010010\n"
-	"001001\n"
-	"010010\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"CHAR 176\n"
-	"010101\n"
-	"000000\n"
-	"101010\n"
-	"000000\n"
-	"010101\n"
-	"000000\n"
-	"101010\n"
-	"000000\n"
-	"CHAR 177\n"
-	"010101\n"
-	"101010\n"
-	"010101\n"
-	"101010\n"
-	"010101\n"
-	"101010\n"
-	"010101\n"
-	"101010\n"
-	"CHAR 178\n"
-	"101010\n"
-	"111111\n"
-	"010101\n"
-	"111111\n"
-	"101010\n"
-	"111111\n"
-	"010101\n"
-	"111111\n"
-	"CHAR 179\n"
-	"000100\n"
-	"000100\n"
-	"000100\n"
-	"000100\n"
-	"000100\n"
-	"000100\n"
-	"000100\n"
-	"000100\n"
-	"CHAR 180\n"
-	"000100\n"
-	"000100\n"
-	"000100\n"
-	"111100\n"
-	"000100\n"
-	"000100\n"
-	"000100\n"
-	"000100\n"
-	"CHAR 181\n"
-	"000000\n"
-	"000000\n"
-	"010010\n"
-	"010010\n"
-	"010010\n"
-	"011100\n"
-	"010000\n"
-	"010000\n"
-	"CHAR 182\n"
-	"010100\n"
-	"010100\n"
-	"010100\n"
-	"110100\n"
-	"010100\n"
-	"010100\n"
-	"010100\n"
-	"010100\n"
-	"CHAR 183\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"111100\n"
-	"010100\n"
-	"010100\n"
-	"010100\n"
-	"010100\n"
-	"CHAR 184\n"
-	"000000\n"
-	"111100\n"
-	"000100\n"
-	"111100\n"
-	"000100\n"
-	"000100\n"
-	"000100\n"
-	"000100\n"
-	"CHAR 185\n"
-	"010100\n"
-	"110100\n"
-	"000100\n"
-	"110100\n"
-	"010100\n"
-	"010100\n"
-	"010100\n"
-	"010100\n"
-	"CHAR 186\n"
-	"010100\n"
-	"010100\n"
-	"010100\n"
-	"010100\n"
-	"010100\n"
-	"010100\n"
-	"010100\n"
-	"010100\n"
-	"CHAR 187\n"
-	"000000\n"
-	"111100\n"
-	"000100\n"
-	"110100\n"
-	"010100\n"
-	"010100\n"
-	"010100\n"
-	"010100\n"
-	"CHAR 188\n"
-	"010100\n"
-	"110100\n"
-	"000100\n"
-	"111100\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"CHAR 189\n"
-	"010100\n"
-	"010100\n"
-	"010100\n"
-	"111100\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"CHAR 190\n"
-	"000100\n"
-	"111100\n"
-	"000100\n"
-	"111100\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"CHAR 191\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"111100\n"
-	"000100\n"
-	"000100\n"
-	"000100\n"
-	"000100\n"
-	"CHAR 192\n"
-	"000100\n"
-	"000100\n"
-	"000100\n"
-	"000111\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"CHAR 193\n"
-	"000100\n"
-	"000100\n"
-	"000100\n"
-	"111111\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"CHAR 194\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"111111\n"
-	"000100\n"
-	"000100\n"
-	"000100\n"
-	"000100\n"
-	"CHAR 195\n"
-	"000100\n"
-	"000100\n"
-	"000100\n"
-	"000111\n"
-	"000100\n"
-	"000100\n"
-	"000100\n"
-	"000100\n"
-	"CHAR 196\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"111111\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"CHAR 197\n"
-	"000100\n"
-	"000100\n"
-	"000100\n"
-	"111111\n"
-	"000100\n"
-	"000100\n"
-	"000100\n"
-	"000100\n"
-	"CHAR 198\n"
-	"000100\n"
-	"000111\n"
-	"000100\n"
-	"000111\n"
-	"000100\n"
-	"000100\n"
-	"000100\n"
-	"000100\n"
-	"CHAR 199\n"
-	"010100\n"
-	"010100\n"
-	"010100\n"
-	"010111\n"
-	"010100\n"
-	"010100\n"
-	"010100\n"
-	"010100\n"
-	"CHAR 200\n"
-	"010100\n"
-	"010111\n"
-	"010000\n"
-	"011111\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"CHAR 201\n"
-	"000000\n"
-	"011111\n"
-	"010000\n"
-	"010111\n"
-	"010100\n"
-	"010100\n"
-	"010100\n"
-	"010100\n"
-	"CHAR 202\n"
-	"010100\n"
-	"110111\n"
-	"000000\n"
-	"111111\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"CHAR 203\n"
-	"000000\n"
-	"111111\n"
-	"000000\n"
-	"110111\n"
-	"010100\n"
-	"010100\n"
-	"010100\n"
-	"010100\n"
-	"CHAR 204\n"
-	"010100\n"
-	"010111\n"
-	"010000\n"
-	"010111\n"
-	"010100\n"
-	"010100\n"
-	"010100\n"
-	"010100\n"
-	"CHAR 205\n"
-	"000000\n"
-	"111111\n"
-	"000000\n"
-	"111111\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"CHAR 206\n"
-	"010100\n"
-	"110111\n"
-	"000000\n"
-	"110111\n"
-	"010100\n"
-	"010100\n"
-	"010100\n"
-	"010100\n"
-	"CHAR 207\n"
-	"000100\n"
-	"111111\n"
-	"000000\n"
-	"111111\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"CHAR 208\n"
-	"010100\n"
-	"010100\n"
-	"010100\n"
-	"111111\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"CHAR 209\n"
-	"000000\n"
-	"111111\n"
-	"000000\n"
-	"111111\n"
-	"000100\n"
-	"000100\n"
-	"000100\n"
-	"000100\n"
-	"CHAR 210\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"111111\n"
-	"010100\n"
-	"010100\n"
-	"010100\n"
-	"010100\n"
-	"CHAR 211\n"
-	"010100\n"
-	"010100\n"
-	"010100\n"
-	"011111\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"CHAR 212\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"111111\n"
-	"CHAR 213\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"111111\n"
-	"111111\n"
-	"CHAR 214\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"111111\n"
-	"111111\n"
-	"111111\n"
-	"CHAR 215\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"111111\n"
-	"111111\n"
-	"111111\n"
-	"111111\n"
-	"CHAR 216\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"111111\n"
-	"111111\n"
-	"111111\n"
-	"111111\n"
-	"111111\n"
-	"CHAR 217\n"
-	"000000\n"
-	"000000\n"
-	"111111\n"
-	"111111\n"
-	"111111\n"
-	"111111\n"
-	"111111\n"
-	"111111\n"
-	"CHAR 218\n"
-	"000000\n"
-	"111111\n"
-	"111111\n"
-	"111111\n"
-	"111111\n"
-	"111111\n"
-	"111111\n"
-	"111111\n"
-	"CHAR 219\n"
-	"111111\n"
-	"111111\n"
-	"111111\n"
-	"111111\n"
-	"111111\n"
-	"111111\n"
-	"111111\n"
-	"111111\n"
-	"CHAR 220\n"
-	"100000\n"
-	"100000\n"
-	"100000\n"
-	"100000\n"
-	"100000\n"
-	"100000\n"
-	"100000\n"
-	"100000\n"
-	"CHAR 221\n"
-	"110000\n"
-	"110000\n"
-	"110000\n"
-	"110000\n"
-	"110000\n"
-	"110000\n"
-	"110000\n"
-	"110000\n"
-	"CHAR 222\n"
-	"111000\n"
-	"111000\n"
-	"111000\n"
-	"111000\n"
-	"111000\n"
-	"111000\n"
-	"111000\n"
-	"111000\n"
-	"CHAR 223\n"
-	"111100\n"
-	"111100\n"
-	"111100\n"
-	"111100\n"
-	"111100\n"
-	"111100\n"
-	"111100\n"
-	"111100\n"
-	"CHAR 224\n"
-	"111110\n"
-	"111110\n"
-	"111110\n"
-	"111110\n"
-	"111110\n"
-	"111110\n"
-	"111110\n"
-	"111110\n"
-	"CHAR 225\n"
-	"000000\n"
-	"011100\n"
-	"010010\n"
-	"011100\n"
-	"010010\n"
-	"010010\n"
-	"011100\n"
-	"010000\n"
-	"CHAR 226\n"
-	"011110\n"
-	"010010\n"
-	"010000\n"
-	"010000\n"
-	"010000\n"
-	"010000\n"
-	"010000\n"
-	"000000\n"
-	"CHAR 227\n"
-	"000000\n"
-	"011111\n"
-	"001010\n"
-	"001010\n"
-	"001010\n"
-	"001010\n"
-	"001010\n"
-	"000000\n"
-	"CHAR 228\n"
-	"001010\n"
-	"000000\n"
-	"001110\n"
-	"000001\n"
-	"001111\n"
-	"010001\n"
-	"001111\n"
-	"000000\n"
-	"CHAR 229\n"
-	"000000\n"
-	"000000\n"
-	"001111\n"
-	"010010\n"
-	"010010\n"
-	"001100\n"
-	"000000\n"
-	"000000\n"
-	"CHAR 230\n"
-	"000000\n"
-	"000000\n"
-	"010010\n"
-	"010010\n"
-	"010010\n"
-	"011100\n"
-	"010000\n"
-	"010000\n"
-	"CHAR 231\n"
-	"000000\n"
-	"000000\n"
-	"001010\n"
-	"010100\n"
-	"000100\n"
-	"000100\n"
-	"000100\n"
-	"000000\n"
-	"CHAR 232\n"
-	"001110\n"
-	"000100\n"
-	"001110\n"
-	"010001\n"
-	"001110\n"
-	"000100\n"
-	"001110\n"
-	"000000\n"
-	"CHAR 233\n"
-	"001100\n"
-	"010010\n"
-	"010010\n"
-	"011110\n"
-	"010010\n"
-	"010010\n"
-	"001100\n"
-	"000000\n"
-	"CHAR 234\n"
-	"000000\n"
-	"001110\n"
-	"010001\n"
-	"010001\n"
-	"001010\n"
-	"001010\n"
-	"011011\n"
-	"000000\n"
-	"CHAR 235\n"
-	"001100\n"
-	"010000\n"
-	"001000\n"
-	"000100\n"
-	"001110\n"
-	"010010\n"
-	"001100\n"
-	"000000\n"
-	"CHAR 236\n"
-	"000000\n"
-	"000000\n"
-	"001010\n"
-	"010101\n"
-	"010101\n"
-	"001010\n"
-	"000000\n"
-	"000000\n"
-	"CHAR 237\n"
-	"000000\n"
-	"000100\n"
-	"001110\n"
-	"010101\n"
-	"010101\n"
-	"001110\n"
-	"000100\n"
-	"000000\n"
-	"CHAR 238\n"
-	"000000\n"
-	"001110\n"
-	"010000\n"
-	"011110\n"
-	"010000\n"
-	"001110\n"
-	"000000\n"
-	"000000\n"
-	"CHAR 239\n"
-	"000000\n"
-	"001100\n"
-	"010010\n"
-	"010010\n"
-	"010010\n"
-	"010010\n"
-	"000000\n"
-	"000000\n"
-	"CHAR 240\n"
-	"000000\n"
-	"011110\n"
-	"000000\n"
-	"011110\n"
-	"000000\n"
-	"011110\n"
-	"000000\n"
-	"000000\n"
-	"CHAR 241\n"
-	"000000\n"
-	"000100\n"
-	"001110\n"
-	"000100\n"
-	"000000\n"
-	"001110\n"
-	"000000\n"
-	"000000\n"
-	"CHAR 242\n"
-	"010000\n"
-	"001100\n"
-	"000010\n"
-	"001100\n"
-	"010000\n"
-	"000000\n"
-	"011110\n"
-	"000000\n"
-	"CHAR 243\n"
-	"000000\n"
-	"000000\n"
-	"111111\n"
-	"111000\n"
-	"100110\n"
-	"100001\n"
-	"100000\n"
-	"111111\n"
-	"CHAR 244\n"
-	"000000\n"
-	"000000\n"
-	"111111\n"
-	"000111\n"
-	"011001\n"
-	"100001\n"
-	"000001\n"
-	"111111\n"
-	"CHAR 245\n"
-	"000100\n"
-	"000100\n"
-	"000100\n"
-	"000100\n"
-	"000100\n"
-	"010100\n"
-	"001000\n"
-	"000000\n"
-	"CHAR 246\n"
-	"001010\n"
-	"000000\n"
-	"001110\n"
-	"010001\n"
-	"010001\n"
-	"010001\n"
-	"001110\n"
-	"000000\n"
-	"CHAR 247\n"
-	"111110\n"
-	"111110\n"
-	"111110\n"
-	"111110\n"
-	"111110\n"
-	"111110\n"
-	"111110\n"
-	"111110\n"
-	"CHAR 248\n"
-	"111100\n"
-	"111100\n"
-	"111100\n"
-	"111100\n"
-	"111100\n"
-	"111100\n"
-	"111100\n"
-	"111100\n"
-	"CHAR 249\n"
-	"111000\n"
-	"111000\n"
-	"111000\n"
-	"111000\n"
-	"111000\n"
-	"111000\n"
-	"111000\n"
-	"111000\n"
-	"CHAR 250\n"
-	"110000\n"
-	"110000\n"
-	"110000\n"
-	"110000\n"
-	"110000\n"
-	"110000\n"
-	"110000\n"
-	"110000\n"
-	"CHAR 251\n"
-	"100000\n"
-	"100000\n"
-	"100000\n"
-	"100000\n"
-	"100000\n"
-	"100000\n"
-	"100000\n"
-	"100000\n"
-	"CHAR 252\n"
-	"001010\n"
-	"000000\n"
-	"010010\n"
-	"010010\n"
-	"010010\n"
-	"010110\n"
-	"001010\n"
-	"000000\n"
-	"CHAR 253\n"
-	"011000\n"
-	"000100\n"
-	"001000\n"
-	"011100\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"CHAR 254\n"
-	"000000\n"
-	"000000\n"
-	"000000\n"
-	"011110\n"
-	"110010\n"
-	"110011\n"
-	"111110\n"
-	"001111\n"
-	"CHAR 255\n"
-	"010010\n"
-	"111111\n"
-	"010010\n"
-	"010010\n"
-	"111111\n"
-	"010010\n"
-	"000000\n"
-	"000000\n";
+// generated by util/bakefont.js from src/bitsy/font
+
+#include "bakedfont.h"
+
+// ascii_small.bitsyfont
+static constexpr BakedFontChar ascii_small_chars[] = {
+	{0, 6, 8, 0, 0, 6, 0},
+	{1, 6, 8, 0, 0, 6, 8},
+	{2, 6, 8, 0, 0, 6, 16},
+	{3, 6, 8, 0, 0, 6, 24},
+	{4, 6, 8, 0, 0, 6, 32},
+	{5, 6, 8, 0, 0, 6, 40},
+	{6, 6, 8, 0, 0, 6, 48},
+	{7, 6, 8, 0, 0, 6, 56},
+	{8, 6, 8, 0, 0, 6, 64},
+	{9, 6, 8, 0, 0, 6, 72},
+	{10, 6, 8, 0, 0, 6, 80},
+	{11, 6, 8, 0, 0, 6, 88},
+	{12, 6, 8, 0, 0, 6, 96},
+	{13, 6, 8, 0, 0, 6, 104},
+	{14, 6, 8, 0, 0, 6, 112},
+	{15, 6, 8, 0, 0, 6, 120},
+	{16, 6, 8, 0, 0, 6, 128},
+	{17, 6, 8, 0, 0, 6, 136},
+	{18, 6, 8, 0, 0, 6, 144},
+	{19, 6, 8, 0, 0, 6, 152},
+	{20, 6, 8, 0, 0, 6, 160},
+	{21, 6, 8, 0, 0, 6, 168},
+	{22, 6, 8, 0, 0, 6, 176},
+	{23, 6, 8, 0, 0, 6, 184},
+	{24, 6, 8, 0, 0, 6, 192},
+	{25, 6, 8, 0, 0, 6, 200},
+	{26, 6, 8, 0, 0, 6, 208},
+	{27, 6, 8, 0, 0, 6, 216},
+	{28, 6, 8, 0, 0, 6, 224},
+	{29, 6, 8, 0, 0, 6, 232},
+	{30, 6, 8, 0, 0, 6, 240},
+	{31, 6, 8, 0, 0, 6, 248},
+	{32, 6, 8, 0, 0, 6, 256},
+	{33, 6, 8, 0, 0, 6, 264},
+	{34, 6, 8, 0, 0, 6, 272},
+	{35, 6, 8, 0, 0, 6, 280},
+	{36, 6, 8, 0, 0, 6, 288},
+	{37, 6, 8, 0, 0, 6, 296},
+	{38, 6, 8, 0, 0, 6, 304},
+	{39, 6, 8, 0, 0, 6, 312},
+	{40, 6, 8, 0, 0, 6, 320},
+	{41, 6, 8, 0, 0, 6, 328},
+	{42, 6, 8, 0, 0, 6, 336},
+	{43, 6, 8, 0, 0, 6, 344},
+	{44, 6, 8, 0, 0, 6, 352},
+	{45, 6, 8, 0, 0, 6, 360},
+	{46, 6, 8, 0, 0, 6, 368},
+	{47, 6, 8, 0, 0, 6, 376},
+	{48, 6, 8, 0, 0, 6, 384},
+	{49, 6, 8, 0, 0, 6, 392},
+	{50, 6, 8, 0, 0, 6, 400},
+	{51, 6, 8, 0, 0, 6, 408},
+	{52, 6, 8, 0, 0, 6, 416},
+	{53, 6, 8, 0, 0, 6, 424},
+	{54, 6, 8, 0, 0, 6, 432},
+	{55, 6, 8, 0, 0, 6, 440},
+	{56, 6, 8, 0, 0, 6, 448},
+	{57, 6, 8, 0, 0, 6, 456},
+	{58, 6, 8, 0, 0, 6, 464},
+	{59, 6, 8, 0, 0, 6, 472},
+	{60, 6, 8, 0, 0, 6, 480},
+	{61, 6, 8, 0, 0, 6, 488},
+	{62, 6, 8, 0, 0, 6, 496},
+	{63, 6, 8, 0, 0, 6, 504},
+	{64, 6, 8, 0, 0, 6, 512},
+	{65, 6, 8, 0, 0, 6, 520},
+	{66, 6, 8, 0, 0, 6, 528},
+	{67, 6, 8, 0, 0, 6, 536},
+	{68, 6, 8, 0, 0, 6, 544},
+	{69, 6, 8, 0, 0, 6, 552},
+	{70, 6, 8, 0, 0, 6, 560},
+	{71, 6, 8, 0, 0, 6, 568},
+	{72, 6, 8, 0, 0, 6, 576},
+	{73, 6, 8, 0, 0, 6, 584},
+	{74, 6, 8, 0, 0, 6, 592},
+	{75, 6, 8, 0, 0, 6, 600},
+	{76, 6, 8, 0, 0, 6, 608},
+	{77, 6, 8, 0, 0, 6, 616},
+	{78, 6, 8, 0, 0, 6, 624},
+	{79, 6, 8, 0, 0, 6, 632},
+	{80, 6, 8, 0, 0, 6, 640},
+	{81, 6, 8, 0, 0, 6, 648},
+	{82, 6, 8, 0, 0, 6, 656},
+	{83, 6, 8, 0, 0, 6, 664},
+	{84, 6, 8, 0, 0, 6, 672},
+	{85, 6, 8, 0, 0, 6, 680},
+	{86, 6, 8, 0, 0, 6, 688},
+	{87, 6, 8, 0, 0, 6, 696},
+	{88, 6, 8, 0, 0, 6, 704},
+	{89, 6, 8, 0, 0, 6, 712},
+	{90, 6, 8, 0, 0, 6, 720},
+	{91, 6, 8, 0, 0, 6, 728},
+	{92, 6, 8, 0, 0, 6, 736},
+	{93, 6, 8, 0, 0, 6, 744},
+	{94, 6, 8, 0, 0, 6, 752},
+	{95, 6, 8, 0, 0, 6, 760},
+	{96, 6, 8, 0, 0, 6, 768},
+	{97, 6, 8, 0, 0, 6, 776},
+	{98, 6, 8, 0, 0, 6, 784},
+	{99, 6, 8, 0, 0, 6, 792},
+	{100, 6, 8, 0, 0, 6, 800},
+	{101, 6, 8, 0, 0, 6, 808},
+	{102, 6, 8, 0, 0, 6, 816},
+	{103, 6, 8, 0, 0, 6, 824},
+	{104, 6, 8, 0, 0, 6, 832},
+	{105, 6, 8, 0, 0, 6, 840},
+	{106, 6, 8, 0, 0, 6, 848},
+	{107, 6, 8, 0, 0, 6, 856},
+	{108, 6, 8, 0, 0, 6, 864},
+	{109, 6, 8, 0, 0, 6, 872},
+	{110, 6, 8, 0, 0, 6, 880},
+	{111, 6, 8, 0, 0, 6, 888},
+	{112, 6, 8, 0, 0, 6, 896},
+	{113, 6, 8, 0, 0, 6, 904},
+	{114, 6, 8, 0, 0, 6, 912},
+	{115, 6, 8, 0, 0, 6, 920},
+	{116, 6, 8, 0, 0, 6, 928},
+	{117, 6, 8, 0, 0, 6, 936},
+	{118, 6, 8, 0, 0, 6, 944},
+	{119, 6, 8, 0, 0, 6, 952},
+	{120, 6, 8, 0, 0, 6, 960},
+	{121, 6, 8, 0, 0, 6, 968},
+	{122, 6, 8, 0, 0, 6, 976},
+	{123, 6, 8, 0, 0, 6, 984},
+	{124, 6, 8, 0, 0, 6, 992},
+	{125, 6, 8, 0, 0, 6, 1000},
+	{126, 6, 8, 0, 0, 6, 1008},
+	{127, 6, 8, 0, 0, 6, 1016},
+	{128, 6, 8, 0, 0, 6, 1024},
+	{129, 6, 8, 0, 0, 6, 1032},
+	{130, 6, 8, 0, 0, 6, 1040},
+	{131, 6, 8, 0, 0, 6, 1048},
+	{132, 6, 8, 0, 0, 6, 1056},
+	{133, 6, 8, 0, 0, 6, 1064},
+	{134, 6, 8, 0, 0, 6, 1072},
+	{135, 6, 8, 0, 0, 6, 1080},
+	{136, 6, 8, 0, 0, 6, 1088},
+	{137, 6, 8, 0, 0, 6, 1096},
+	{138, 6, 8, 0, 0, 6, 1104},
+	{139, 6, 8, 0, 0, 6, 1112},
+	{140, 6, 8, 0, 0, 6, 1120},
+	{141, 6, 8, 0, 0, 6, 1128},
+	{142, 6, 8, 0, 0, 6, 1136},
+	{143, 6, 8, 0, 0, 6, 1144},
+	{144, 6, 8, 0, 0, 6, 1152},
+	{145, 6, 8, 0, 0, 6, 1160},
+	{146, 6, 8, 0, 0, 6, 1168},
+	{147, 6, 8, 0, 0, 6, 1176},
+	{148, 6, 8, 0, 0, 6, 1184},
+	{149, 6, 8, 0, 0, 6, 1192},
+	{150, 6, 8, 0, 0, 6, 1200},
+	{151, 6, 8, 0, 0, 6, 1208},
+	{152, 6, 8, 0, 0, 6, 1216},
+	{153, 6, 8, 0, 0, 6, 1224},
+	{154, 6, 8, 0, 0, 6, 1232},
+	{155, 6, 8, 0, 0, 6, 1240},
+	{156, 6, 8, 0, 0, 6, 1248},
+	{157, 6, 8, 0, 0, 6, 1256},
+	{158, 6, 8, 0, 0, 6, 1264},
+	{159, 6, 8, 0, 0, 6, 1272},
+	{160, 6, 8, 0, 0, 6, 1280},
+	{161, 6, 8, 0, 0, 6, 1288},
+	{162, 6, 8, 0, 0, 6, 1296},
+	{163, 6, 8, 0, 0, 6, 1304},
+	{164, 6, 8, 0, 0, 6, 1312},
+	{165, 6, 8, 0, 0, 6, 1320},
+	{166, 6, 8, 0, 0, 6, 1328},
+	{167, 6, 8, 0, 0, 6, 1336},
+	{168, 6, 8, 0, 0, 6, 1344},
+	{169, 6, 8, 0, 0, 6, 1352},
+	{170, 6, 8, 0, 0, 6, 1360},
+	{171, 6, 8, 0, 0, 6, 1368},
+	{172, 6, 8, 0, 0, 6, 1376},
+	{173, 6, 8, 0, 0, 6, 1384},
+	{174, 6, 8, 0, 0, 6, 1392},
+	{175, 6, 8, 0, 0, 6, 1400},
+	{176, 6, 8, 0, 0, 6, 1408},
+	{177, 6, 8, 0, 0, 6, 1416},
+	{178, 6, 8, 0, 0, 6, 1424},
+	{179, 6, 8, 0, 0, 6, 1432},
+	{180, 6, 8, 0, 0, 6, 1440},
+	{181, 6, 8, 0, 0, 6, 1448},
+	{182, 6, 8, 0, 0, 6, 1456},
+	{183, 6, 8, 0, 0, 6, 1464},
+	{184, 6, 8, 0, 0, 6, 1472},
+	{185, 6, 8, 0, 0, 6, 1480},
+	{186, 6, 8, 0, 0, 6, 1488},
+	{187, 6, 8, 0, 0, 6, 1496},
+	{188, 6, 8, 0, 0, 6, 1504},
+	{189, 6, 8, 0, 0, 6, 1512},
+	{190, 6, 8, 0, 0, 6, 1520},
+	{191, 6, 8, 0, 0, 6, 1528},
+	{192, 6, 8, 0, 0, 6, 1536},
+	{193, 6, 8, 0, 0, 6, 1544},
+	{194, 6, 8, 0, 0, 6, 1552},
+	{195, 6, 8, 0, 0, 6, 1560},
+	{196, 6, 8, 0, 0, 6, 1568},
+	{197, 6, 8, 0, 0, 6, 1576},
+	{198, 6, 8, 0, 0, 6, 1584},
+	{199, 6, 8, 0, 0, 6, 1592},
+	{200, 6, 8, 0, 0, 6, 1600},
+	{201, 6, 8, 0, 0, 6, 1608},
+	{202, 6, 8, 0, 0, 6, 1616},
+	{203, 6, 8, 0, 0, 6, 1624},
+	{204, 6, 8, 0, 0, 6, 1632},
+	{205, 6, 8, 0, 0, 6, 1640},
+	{206, 6, 8, 0, 0, 6, 1648},
+	{207, 6, 8, 0, 0, 6, 1656},
+	{208, 6, 8, 0, 0, 6, 1664},
+	{209, 6, 8, 0, 0, 6, 1672},
+	{210, 6, 8, 0, 0, 6, 1680},
+	{211, 6, 8, 0, 0, 6, 1688},
+	{212, 6, 8, 0, 0, 6, 1696},
+	{213, 6, 8, 0, 0, 6, 1704},
+	{214, 6, 8, 0, 0, 6, 1712},
+	{215, 6, 8, 0, 0, 6, 1720},
+	{216, 6, 8, 0, 0, 6, 1728},
+	{217, 6, 8, 0, 0, 6, 1736},
+	{218, 6, 8, 0, 0, 6, 1744},
+	{219, 6, 8, 0, 0, 6, 1752},
+	{220, 6, 8, 0, 0, 6, 1760},
+	{221, 6, 8, 0, 0, 6, 1768},
+	{222, 6, 8, 0, 0, 6, 1776},
+	{223, 6, 8, 0, 0, 6, 1784},
+	{224, 6, 8, 0, 0, 6, 1792},
+	{225, 6, 8, 0, 0, 6, 1800},
+	{226, 6, 8, 0, 0, 6, 1808},
+	{227, 6, 8, 0, 0, 6, 1816},
+	{228, 6, 8, 0, 0, 6, 1824},
+	{229, 6, 8, 0, 0, 6, 1832},
+	{230, 6, 8, 0, 0, 6, 1840},
+	{231, 6, 8, 0, 0, 6, 1848},
+	{232, 6, 8, 0, 0, 6, 1856},
+	{233, 6, 8, 0, 0, 6, 1864},
+	{234, 6, 8, 0, 0, 6, 1872},
+	{235, 6, 8, 0, 0, 6, 1880},
+	{236, 6, 8, 0, 0, 6, 1888},
+	{237, 6, 8, 0, 0, 6, 1896},
+	{238, 6, 8, 0, 0, 6, 1904},
+	{239, 6, 8, 0, 0, 6, 1912},
+	{240, 6, 8, 0, 0, 6, 1920},
+	{241, 6, 8, 0, 0, 6, 1928},
+	{242, 6, 8, 0, 0, 6, 1936},
+	{243, 6, 8, 0, 0, 6, 1944},
+	{244, 6, 8, 0, 0, 6, 1952},
+	{245, 6, 8, 0, 0, 6, 1960},
+	{246, 6, 8, 0, 0, 6, 1968},
+	{247, 6, 8, 0, 0, 6, 1976},
+	{248, 6, 8, 0, 0, 6, 1984},
+	{249, 6, 8, 0, 0, 6, 1992},
+	{250, 6, 8, 0, 0, 6, 2000},
+	{251, 6, 8, 0, 0, 6, 2008},
+	{252, 6, 8, 0, 0, 6, 2016},
+	{253, 6, 8, 0, 0, 6, 2024},
+	{254, 6, 8, 0, 0, 6, 2032},
+	{255, 6, 8, 0, 0, 6, 2040},
+};
+
+static constexpr uint8_t ascii_small_bits[] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x44, 0x6c, 0x44, 0x54, 0x44, 0x38, 0x00,
+	0x38, 0x7c, 0x54, 0x7c, 0x44, 0x7c, 0x38, 0x00, 0x00, 0x28, 0x7c, 0x7c, 0x7c, 0x38, 0x10, 0x00,
+	0x00, 0x00, 0x28, 0x38, 0x38, 0x10, 0x00, 0x00, 0x10, 0x38, 0x38, 0x10, 0x7c, 0x7c, 0x10, 0x00,
+	0x00, 0x10, 0x38, 0x7c, 0x7c, 0x10, 0x38, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x00, 0x00, 0x00,
+	0xfc, 0xfc, 0xfc, 0xcc, 0xcc, 0xfc, 0xfc, 0xfc, 0x00, 0x00, 0x78, 0x48, 0x48, 0x78, 0x00, 0x00,
+	0xfc, 0xfc, 0x84, 0xb4, 0xb4, 0x84, 0xfc, 0xfc, 0x00, 0x1c, 0x0c, 0x34, 0x48, 0x48, 0x30, 0x00,
+	0x38, 0x44, 0x44, 0x38, 0x10, 0x38, 0x10, 0x00, 0x10, 0x18, 0x14, 0x10, 0x30, 0x70, 0x60, 0x00,
+	0x0c, 0x34, 0x2c, 0x34, 0x2c, 0x6c, 0x60, 0x00, 0x00, 0x54, 0x38, 0x6c, 0x38, 0x54, 0x00, 0x00,
+	0x20, 0x30, 0x38, 0x3c, 0x38, 0x30, 0x20, 0x00, 0x08, 0x18, 0x38, 0x78, 0x38, 0x18, 0x08, 0x00,
+	0x10, 0x38, 0x7c, 0x10, 0x7c, 0x38, 0x10, 0x00, 0x28, 0x28, 0x28, 0x28, 0x28, 0x00, 0x28, 0x00,
+	0x3c, 0x54, 0x54, 0x34, 0x14, 0x14, 0x14, 0x00, 0x38, 0x44, 0x30, 0x28, 0x18, 0x44, 0x38, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x78, 0x00, 0x10, 0x38, 0x7c, 0x10, 0x7c, 0x38, 0x10, 0x38,
+	0x10, 0x38, 0x7c, 0x10, 0x10, 0x10, 0x10, 0x00, 0x10, 0x10, 0x10, 0x10, 0x7c, 0x38, 0x10, 0x00,
+	0x00, 0x10, 0x18, 0x7c, 0x18, 0x10, 0x00, 0x00, 0x00, 0x10, 0x30, 0x7c, 0x30, 0x10, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x40, 0x40, 0x40, 0x7c, 0x00, 0x00, 0x28, 0x28, 0x7c, 0x28, 0x28, 0x00, 0x00,
+	0x10, 0x10, 0x38, 0x38, 0x7c, 0x7c, 0x00, 0x00, 0x7c, 0x7c, 0x38, 0x38, 0x10, 0x10, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x38, 0x38, 0x10, 0x10, 0x00, 0x10, 0x00,
+	0x6c, 0x6c, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x7c, 0x28, 0x28, 0x7c, 0x28, 0x00,
+	0x20, 0x38, 0x40, 0x30, 0x08, 0x70, 0x10, 0x00, 0x64, 0x64, 0x08, 0x10, 0x20, 0x4c, 0x4c, 0x00,
+	0x20, 0x50, 0x50, 0x20, 0x54, 0x48, 0x34, 0x00, 0x30, 0x30, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x10, 0x20, 0x20, 0x20, 0x20, 0x20, 0x10, 0x00, 0x20, 0x10, 0x10, 0x10, 0x10, 0x10, 0x20, 0x00,
+	0x00, 0x28, 0x38, 0x7c, 0x38, 0x28, 0x00, 0x00, 0x00, 0x10, 0x10, 0x7c, 0x10, 0x10, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x20, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x00, 0x00, 0x04, 0x08, 0x10, 0x20, 0x40, 0x00, 0x00,
+	0x38, 0x44, 0x4c, 0x54, 0x64, 0x44, 0x38, 0x00, 0x10, 0x30, 0x10, 0x10, 0x10, 0x10, 0x38, 0x00,
+	0x38, 0x44, 0x04, 0x18, 0x20, 0x40, 0x7c, 0x00, 0x38, 0x44, 0x04, 0x38, 0x04, 0x44, 0x38, 0x00,
+	0x08, 0x18, 0x28, 0x48, 0x7c, 0x08, 0x08, 0x00, 0x7c, 0x40, 0x40, 0x78, 0x04, 0x44, 0x38, 0x00,
+	0x18, 0x20, 0x40, 0x78, 0x44, 0x44, 0x38, 0x00, 0x7c, 0x04, 0x08, 0x10, 0x20, 0x20, 0x20, 0x00,
+	0x38, 0x44, 0x44, 0x38, 0x44, 0x44, 0x38, 0x00, 0x38, 0x44, 0x44, 0x3c, 0x04, 0x08, 0x30, 0x00,
+	0x00, 0x00, 0x30, 0x30, 0x00, 0x30, 0x30, 0x00, 0x00, 0x00, 0x30, 0x30, 0x00, 0x30, 0x30, 0x20,
+	0x08, 0x10, 0x20, 0x40, 0x20, 0x10, 0x08, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x7c, 0x00, 0x00,
+	0x20, 0x10, 0x08, 0x04, 0x08, 0x10, 0x20, 0x00, 0x38, 0x44, 0x04, 0x18, 0x10, 0x00, 0x10, 0x00,
+	0x38, 0x44, 0x5c, 0x54, 0x5c, 0x40, 0x38, 0x00, 0x38, 0x44, 0x44, 0x44, 0x7c, 0x44, 0x44, 0x00,
+	0x78, 0x44, 0x44, 0x78, 0x44, 0x44, 0x78, 0x00, 0x38, 0x44, 0x40, 0x40, 0x40, 0x44, 0x38, 0x00,
+	0x78, 0x44, 0x44, 0x44, 0x44, 0x44, 0x78, 0x00, 0x7c, 0x40, 0x40, 0x78, 0x40, 0x40, 0x7c, 0x00,
+	0x7c, 0x40, 0x40, 0x78, 0x40, 0x40, 0x40, 0x00, 0x38, 0x44, 0x40, 0x5c, 0x44, 0x44, 0x3c, 0x00,
+	0x44, 0x44, 0x44, 0x7c, 0x44, 0x44, 0x44, 0x00, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x00,
+	0x04, 0x04, 0x04, 0x04, 0x44, 0x44, 0x38, 0x00, 0x44, 0x48, 0x50, 0x60, 0x50, 0x48, 0x44, 0x00,
+	0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x7c, 0x00, 0x44, 0x6c, 0x54, 0x44, 0x44, 0x44, 0x44, 0x00,
+	0x44, 0x64, 0x54, 0x4c, 0x44, 0x44, 0x44, 0x00, 0x38, 0x44, 0x44, 0x44, 0x44, 0x44, 0x38, 0x00,
+	0x78, 0x44, 0x44, 0x78, 0x40, 0x40, 0x40, 0x00, 0x38, 0x44, 0x44, 0x44, 0x54, 0x48, 0x34, 0x00,
+	0x78, 0x44, 0x44, 0x78, 0x48, 0x44, 0x44, 0x00, 0x38, 0x44, 0x40, 0x38, 0x04, 0x44, 0x38, 0x00,
+	0x7c, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x38, 0x00,
+	0x44, 0x44, 0x44, 0x44, 0x44, 0x28, 0x10, 0x00, 0x44, 0x44, 0x54, 0x54, 0x54, 0x54, 0x28, 0x00,
+	0x44, 0x44, 0x28, 0x10, 0x28, 0x44, 0x44, 0x00, 0x44, 0x44, 0x44, 0x28, 0x10, 0x10, 0x10, 0x00,
+	0x78, 0x08, 0x10, 0x20, 0x40, 0x40, 0x78, 0x00, 0x38, 0x20, 0x20, 0x20, 0x20, 0x20, 0x38, 0x00,
+	0x00, 0x40, 0x20, 0x10, 0x08, 0x04, 0x00, 0x00, 0x38, 0x08, 0x08, 0x08, 0x08, 0x08, 0x38, 0x00,
+	0x10, 0x28, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc,
+	0x30, 0x30, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x04, 0x3c, 0x44, 0x3c, 0x00,
+	0x40, 0x40, 0x78, 0x44, 0x44, 0x44, 0x78, 0x00, 0x00, 0x00, 0x38, 0x44, 0x40, 0x44, 0x38, 0x00,
+	0x04, 0x04, 0x3c, 0x44, 0x44, 0x44, 0x3c, 0x00, 0x00, 0x00, 0x38, 0x44, 0x78, 0x40, 0x38, 0x00,
+	0x18, 0x20, 0x20, 0x78, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x3c, 0x44, 0x44, 0x3c, 0x04, 0x38,
+	0x40, 0x40, 0x70, 0x48, 0x48, 0x48, 0x48, 0x00, 0x10, 0x00, 0x10, 0x10, 0x10, 0x10, 0x18, 0x00,
+	0x08, 0x00, 0x18, 0x08, 0x08, 0x08, 0x48, 0x30, 0x40, 0x40, 0x48, 0x50, 0x60, 0x50, 0x48, 0x00,
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x18, 0x00, 0x00, 0x00, 0x68, 0x54, 0x54, 0x44, 0x44, 0x00,
+	0x00, 0x00, 0x70, 0x48, 0x48, 0x48, 0x48, 0x00, 0x00, 0x00, 0x38, 0x44, 0x44, 0x44, 0x38, 0x00,
+	0x00, 0x00, 0x78, 0x44, 0x44, 0x44, 0x78, 0x40, 0x00, 0x00, 0x3c, 0x44, 0x44, 0x44, 0x3c, 0x04,
+	0x00, 0x00, 0x58, 0x24, 0x20, 0x20, 0x70, 0x00, 0x00, 0x00, 0x38, 0x40, 0x38, 0x04, 0x38, 0x00,
+	0x00, 0x20, 0x78, 0x20, 0x20, 0x28, 0x10, 0x00, 0x00, 0x00, 0x48, 0x48, 0x48, 0x58, 0x28, 0x00,
+	0x00, 0x00, 0x44, 0x44, 0x44, 0x28, 0x10, 0x00, 0x00, 0x00, 0x44, 0x44, 0x54, 0x7c, 0x28, 0x00,
+	0x00, 0x00, 0x48, 0x48, 0x30, 0x48, 0x48, 0x00, 0x00, 0x00, 0x48, 0x48, 0x48, 0x38, 0x10, 0x60,
+	0x00, 0x00, 0x78, 0x08, 0x30, 0x40, 0x78, 0x00, 0x18, 0x20, 0x20, 0x60, 0x20, 0x20, 0x18, 0x00,
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x30, 0x08, 0x08, 0x0c, 0x08, 0x08, 0x30, 0x00,
+	0x28, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x38, 0x6c, 0x44, 0x44, 0x7c, 0x00, 0x00,
+	0x38, 0x44, 0x40, 0x40, 0x44, 0x38, 0x10, 0x30, 0x48, 0x00, 0x48, 0x48, 0x48, 0x58, 0x28, 0x00,
+	0x0c, 0x00, 0x38, 0x44, 0x78, 0x40, 0x38, 0x00, 0x38, 0x00, 0x38, 0x04, 0x3c, 0x44, 0x3c, 0x00,
+	0x28, 0x00, 0x38, 0x04, 0x3c, 0x44, 0x3c, 0x00, 0x30, 0x00, 0x38, 0x04, 0x3c, 0x44, 0x3c, 0x00,
+	0x38, 0x28, 0x38, 0x04, 0x3c, 0x44, 0x3c, 0x00, 0x00, 0x38, 0x44, 0x40, 0x44, 0x38, 0x10, 0x30,
+	0x38, 0x00, 0x38, 0x44, 0x78, 0x40, 0x38, 0x00, 0x28, 0x00, 0x38, 0x44, 0x78, 0x40, 0x38, 0x00,
+	0x30, 0x00, 0x38, 0x44, 0x78, 0x40, 0x38, 0x00, 0x28, 0x00, 0x10, 0x10, 0x10, 0x10, 0x18, 0x00,
+	0x10, 0x28, 0x00, 0x10, 0x10, 0x10, 0x18, 0x00, 0x20, 0x00, 0x10, 0x10, 0x10, 0x10, 0x18, 0x00,
+	0x28, 0x00, 0x10, 0x28, 0x44, 0x7c, 0x44, 0x00, 0x38, 0x28, 0x38, 0x6c, 0x44, 0x7c, 0x44, 0x00,
+	0x0c, 0x00, 0x7c, 0x40, 0x78, 0x40, 0x7c, 0x00, 0x00, 0x00, 0x78, 0x14, 0x7c, 0x50, 0x3c, 0x00,
+	0x3c, 0x50, 0x50, 0x7c, 0x50, 0x50, 0x5c, 0x00, 0x38, 0x00, 0x30, 0x48, 0x48, 0x48, 0x30, 0x00,
+	0x28, 0x00, 0x30, 0x48, 0x48, 0x48, 0x30, 0x00, 0x60, 0x00, 0x30, 0x48, 0x48, 0x48, 0x30, 0x00,
+	0x38, 0x00, 0x48, 0x48, 0x48, 0x58, 0x28, 0x00, 0x60, 0x00, 0x48, 0x48, 0x48, 0x58, 0x28, 0x00,
+	0x28, 0x00, 0x48, 0x48, 0x48, 0x38, 0x10, 0x60, 0x48, 0x30, 0x48, 0x48, 0x48, 0x48, 0x30, 0x00,
+	0x28, 0x00, 0x48, 0x48, 0x48, 0x48, 0x30, 0x00, 0x00, 0x10, 0x38, 0x40, 0x40, 0x38, 0x10, 0x00,
+	0x18, 0x24, 0x20, 0x78, 0x20, 0x24, 0x5c, 0x00, 0x44, 0x28, 0x10, 0x7c, 0x10, 0x7c, 0x10, 0x00,
+	0x60, 0x50, 0x50, 0x68, 0x5c, 0x48, 0x48, 0x00, 0x08, 0x14, 0x10, 0x38, 0x10, 0x10, 0x50, 0x20,
+	0x18, 0x00, 0x38, 0x04, 0x3c, 0x44, 0x3c, 0x00, 0x18, 0x00, 0x10, 0x10, 0x10, 0x10, 0x18, 0x00,
+	0x18, 0x00, 0x30, 0x48, 0x48, 0x48, 0x30, 0x00, 0x18, 0x00, 0x48, 0x48, 0x48, 0x58, 0x28, 0x00,
+	0x28, 0x50, 0x00, 0x70, 0x48, 0x48, 0x48, 0x00, 0x28, 0x50, 0x00, 0x48, 0x68, 0x58, 0x48, 0x00,
+	0x38, 0x04, 0x3c, 0x44, 0x3c, 0x00, 0x3c, 0x00, 0x30, 0x48, 0x48, 0x48, 0x30, 0x00, 0x78, 0x00,
+	0x10, 0x00, 0x10, 0x30, 0x40, 0x44, 0x38, 0x00, 0x00, 0x00, 0x7c, 0x40, 0x40, 0x40, 0x00, 0x00,
+	0x00, 0x00, 0xfc, 0x04, 0x04, 0x00, 0x00, 0x00, 0x40, 0x48, 0x50, 0x38, 0x44, 0x08, 0x1c, 0x00,
+	0x40, 0x48, 0x50, 0x2c, 0x54, 0x1c, 0x04, 0x00, 0x10, 0x00, 0x10, 0x10, 0x38, 0x38, 0x10, 0x00,
+	0x00, 0x00, 0x24, 0x48, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x24, 0x48, 0x00, 0x00, 0x00,
+	0x54, 0x00, 0xa8, 0x00, 0x54, 0x00, 0xa8, 0x00, 0x54, 0xa8, 0x54, 0xa8, 0x54, 0xa8, 0x54, 0xa8,
+	0xa8, 0xfc, 0x54, 0xfc, 0xa8, 0xfc, 0x54, 0xfc, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+	0x10, 0x10, 0x10, 0xf0, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x48, 0x48, 0x48, 0x70, 0x40, 0x40,
+	0x50, 0x50, 0x50, 0xd0, 0x50, 0x50, 0x50, 0x50, 0x00, 0x00, 0x00, 0xf0, 0x50, 0x50, 0x50, 0x50,
+	0x00, 0xf0, 0x10, 0xf0, 0x10, 0x10, 0x10, 0x10, 0x50, 0xd0, 0x10, 0xd0, 0x50, 0x50, 0x50, 0x50,
+	0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x00, 0xf0, 0x10, 0xd0, 0x50, 0x50, 0x50, 0x50,
+	0x50, 0xd0, 0x10, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x50, 0x50, 0x50, 0xf0, 0x00, 0x00, 0x00, 0x00,
+	0x10, 0xf0, 0x10, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x10, 0x10, 0x10, 0x10,
+	0x10, 0x10, 0x10, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0xfc, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xfc, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1c, 0x10, 0x10, 0x10, 0x10,
+	0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0xfc, 0x10, 0x10, 0x10, 0x10,
+	0x10, 0x1c, 0x10, 0x1c, 0x10, 0x10, 0x10, 0x10, 0x50, 0x50, 0x50, 0x5c, 0x50, 0x50, 0x50, 0x50,
+	0x50, 0x5c, 0x40, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x40, 0x5c, 0x50, 0x50, 0x50, 0x50,
+	0x50, 0xdc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xdc, 0x50, 0x50, 0x50, 0x50,
+	0x50, 0x5c, 0x40, 0x5c, 0x50, 0x50, 0x50, 0x50, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00,
+	0x50, 0xdc, 0x00, 0xdc, 0x50, 0x50, 0x50, 0x50, 0x10, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00,
+	0x50, 0x50, 0x50, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x10, 0x10, 0x10, 0x10,
+	0x00, 0x00, 0x00, 0xfc, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x7c, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc, 0xfc, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xfc,
+	0x00, 0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc,
+	0x00, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc,
+	0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+	0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+	0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0x00, 0x70, 0x48, 0x70, 0x48, 0x48, 0x70, 0x40,
+	0x78, 0x48, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x7c, 0x28, 0x28, 0x28, 0x28, 0x28, 0x00,
+	0x28, 0x00, 0x38, 0x04, 0x3c, 0x44, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x48, 0x48, 0x30, 0x00, 0x00,
+	0x00, 0x00, 0x48, 0x48, 0x48, 0x70, 0x40, 0x40, 0x00, 0x00, 0x28, 0x50, 0x10, 0x10, 0x10, 0x00,
+	0x38, 0x10, 0x38, 0x44, 0x38, 0x10, 0x38, 0x00, 0x30, 0x48, 0x48, 0x78, 0x48, 0x48, 0x30, 0x00,
+	0x00, 0x38, 0x44, 0x44, 0x28, 0x28, 0x6c, 0x00, 0x30, 0x40, 0x20, 0x10, 0x38, 0x48, 0x30, 0x00,
+	0x00, 0x00, 0x28, 0x54, 0x54, 0x28, 0x00, 0x00, 0x00, 0x10, 0x38, 0x54, 0x54, 0x38, 0x10, 0x00,
+	0x00, 0x38, 0x40, 0x78, 0x40, 0x38, 0x00, 0x00, 0x00, 0x30, 0x48, 0x48, 0x48, 0x48, 0x00, 0x00,
+	0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x00, 0x00, 0x10, 0x38, 0x10, 0x00, 0x38, 0x00, 0x00,
+	0x40, 0x30, 0x08, 0x30, 0x40, 0x00, 0x78, 0x00, 0x00, 0x00, 0xfc, 0xe0, 0x98, 0x84, 0x80, 0xfc,
+	0x00, 0x00, 0xfc, 0x1c, 0x64, 0x84, 0x04, 0xfc, 0x10, 0x10, 0x10, 0x10, 0x10, 0x50, 0x20, 0x00,
+	0x28, 0x00, 0x38, 0x44, 0x44, 0x44, 0x38, 0x00, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8,
+	0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0,
+	0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+	0x28, 0x00, 0x48, 0x48, 0x48, 0x58, 0x28, 0x00, 0x60, 0x10, 0x20, 0x70, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x78, 0xc8, 0xcc, 0xf8, 0x3c, 0x48, 0xfc, 0x48, 0x48, 0xfc, 0x48, 0x00, 0x00,
+};
+
+static constexpr BakedFont bakedFonts[] = {
+	{"ascii_small", 6, 8, ascii_small_chars, 256, ascii_small_bits},
+};
 
 #endif
\ No newline at end of file
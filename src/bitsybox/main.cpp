@@ -6,17 +6,36 @@
 #include <unistd.h> // for getcwd, chdir
 #include <limits.h> // for PATH_MAX
 #include <dirent.h>
+#include <algorithm>
 #include "duktape/duktape.h"
 #include "LittleFS.h"
+#include "bitsybox.h"
+#include "profiler.h"
+#include "pool.h"
+#include "display.h"
+#include "pacer.h"
+#include "transition.h"
+#include "font.h"
 
 #ifndef BUILD_DEBUG
 #include "engine.h"
-#include "font.h"
 #include "boot.h"
+#include "bytecode.h"
+#endif
+
+// load the engine from the bytecode in bytecode.h instead of compiling engine.h: about
+// 10x faster to load (2.2 ms vs 24 ms on the host) for the same VM heap, within 1%
+// either way (boot menu 1122368 vs 1117824 bytes, forest 1746768 vs 1735872). Set it
+// to 0 in an env's build_flags to compile the source instead (--engine-source on the host).
+#ifndef ENGINE_BYTECODE
+#define ENGINE_BYTECODE 1
 #endif
 
-#define SYSTEM_PALETTE_MAX 256
-#define SYSTEM_DRAWING_BUFFER_MAX 1024
+// keep one VM with the engine loaded for the boot menu and every game, reset between
+// them (see vmReset()), instead of a new heap that loads the engine again each time
+#ifndef VM_SHARED
+#define VM_SHARED 0
+#endif
 
 /* TFT */
 TFT_eSPI tft = TFT_eSPI();
@@ -34,15 +53,10 @@ int roomSize = 16;
 int shouldContinue = 1;
 
 /* GRAPHICS */
-typedef struct Color
-{
-    int r;
-    int g;
-    int b;
-} Color;
-
 int curGraphicsMode = 0;
-Color systemPalette[SYSTEM_PALETTE_MAX];
+uint16_t systemPalette[SYSTEM_PALETTE_MAX];
+uint32_t systemPaletteEntryGeneration[SYSTEM_PALETTE_MAX];
+uint32_t systemPaletteGeneration = 0;
 int curBufferId = -1;
 
 int screenBufferId = 0;
@@ -53,6 +67,59 @@ int nextBufferId = 2;
 int textboxWidth = 0;
 int textboxHeight = 0;
 
+// tiles are strictly 2-color, so instead of a sprite each they live in one atlas as
+// 8 rows of bits (leftmost pixel in the high bit) plus a palette index pair
+#define TILE_ATLAS_ROWS 8
+
+typedef struct TileAtlasEntry
+{
+    uint8_t bits[TILE_ATLAS_ROWS];
+    uint8_t fg;
+    uint8_t bg;
+} TileAtlasEntry;
+
+TileAtlasEntry tileAtlas[SYSTEM_DRAWING_BUFFER_MAX]; // indexed by tile buffer id
+uint32_t tileAtlasGeneration = 0; // bumped whenever any tile's pixels may have changed
+
+// the room tiles as bitsyDrawRoom() last expanded them (screenSize x screenSize palette
+// indices), kept between frames: a frame only re-expands the cells whose tile changed
+// (animation, tilemap edits, a new room) and copies back the cells something else was
+// drawn over since (sprites, items, the textbox). One cell is one tile and one display cell.
+#define ROOM_LAYER_CELLS 16 // per side
+
+uint8_t *roomLayer = NULL; // allocated on first use
+uint16_t roomLayerTileIds[ROOM_LAYER_CELLS * ROOM_LAYER_CELLS];
+int roomLayerBackground = -1;
+uint32_t roomLayerAtlasGeneration = 0;
+bool isRoomLayerValid = false;
+bool isScreenCellCovered[ROOM_LAYER_CELLS][ROOM_LAYER_CELLS]; // screen differs from the layer here
+
+// room images for transitions (screenSize x screenSize palette indices), rasterized
+// natively and addressed by handle; allocated on first use, freed when released
+#define ROOM_SNAPSHOT_MAX 2
+
+uint8_t *roomSnapshots[ROOM_SNAPSHOT_MAX];
+
+// dialog glyphs (font chars and drawings shown in text) as 1-bit rows of
+// ceil(width / 8) bytes, leftmost pixel in the high bit, packed back to back.
+// chars of baked fonts (font.h) are drawn from flash under ids of their own:
+// ((font index + 1) << GLYPH_BAKED_SHIFT) + char index
+#define GLYPH_MAX 512
+#define GLYPH_DATA_MAX 4096
+#define GLYPH_BAKED_SHIFT 20
+
+typedef struct GlyphEntry
+{
+    const uint8_t *bits;
+    uint8_t width;
+    uint8_t height;
+} GlyphEntry;
+
+GlyphEntry glyphs[GLYPH_MAX];
+int glyphCount = 0;
+uint8_t glyphData[GLYPH_DATA_MAX];
+int glyphDataUsed = 0;
+
 int windowWidth = 0;
 int windowHeight = 0;
 
@@ -191,6 +258,181 @@ int loadEmbeddedFile(duk_context *ctx, char *fileStr, char *variableName)
     return 1;
 }
 
+#ifndef BUILD_DEBUG
+/* EMBEDDED SCRIPTS */
+// engine.h / boot.h sources in load order (boot.js last). `program --compile-engine`
+// dumps each one to Duktape bytecode in bytecode.h, in the same order, along with a
+// hash of the sources so stale bytecode is never run.
+static const char *embeddedScriptNames[] = {
+    "script.js",
+    "font.js",
+    "transition.js",
+    "dialog.js",
+    "renderer.js",
+    "bitsy.js",
+    "boot.js",
+};
+
+#define EMBEDDED_SCRIPT_COUNT (int)(sizeof(embeddedScriptNames) / sizeof(embeddedScriptNames[0]))
+#define EMBEDDED_SCRIPT_BOOT (EMBEDDED_SCRIPT_COUNT - 1)
+
+static const char *embeddedScriptSource(int index)
+{
+    const char *sources[] = {script_js, font_js, transition_js, dialog_js, renderer_js, bitsy_js, boot_js};
+    return sources[index];
+}
+
+// FNV-1a over every source, each followed by a 0 byte
+static uint32_t hashEmbeddedScripts()
+{
+    uint32_t hash = 2166136261UL;
+
+    for (int i = 0; i < EMBEDDED_SCRIPT_COUNT; i++)
+    {
+        const char *c = embeddedScriptSource(i);
+        do
+        {
+            hash = (hash ^ (uint8_t)*c) * 16777619UL;
+        } while (*c++ != '\0');
+    }
+
+    return hash;
+}
+
+static bool isBytecodeUsable()
+{
+    static int isUsable = -1; // checked once per boot
+
+    if (isUsable < 0)
+    {
+#ifdef BITSYBOX_HOST
+        bool isRequested = ENGINE_BYTECODE && !hostOptions()->engineSource;
+#else
+        bool isRequested = ENGINE_BYTECODE;
+#endif
+        isUsable = isRequested && EMBEDDED_BYTECODE_COUNT == EMBEDDED_SCRIPT_COUNT &&
+                   EMBEDDED_BYTECODE_SOURCE_HASH == hashEmbeddedScripts();
+
+        if (isRequested && !isUsable)
+        {
+            Serial.println("Engine bytecode is stale (rerun --compile-engine): compiling the engine source");
+        }
+    }
+
+    return isUsable;
+}
+
+static duk_ret_t runBytecode(duk_context *ctx, void *udata)
+{
+    duk_load_function(ctx);
+    duk_call(ctx, 0);
+
+    return 1;
+}
+
+// run one dumped program; the bytecode stays in flash, loading copies what it needs
+int loadEmbeddedBytecode(duk_context *ctx, const uint8_t *bytecode, size_t length)
+{
+    int success = 1;
+
+    duk_push_external_buffer(ctx);
+    duk_config_buffer(ctx, -1, (void *)bytecode, length);
+
+    if (duk_safe_call(ctx, runBytecode, NULL, 1, 1) != 0)
+    {
+        Serial.printf("Load Embedded Bytecode Error: %s\n", duk_safe_to_string(ctx, -1));
+        success = 0;
+    }
+    duk_pop(ctx);
+
+    return success;
+}
+
+int loadEmbeddedEngineScript(duk_context *ctx, int index)
+{
+    if (isBytecodeUsable())
+    {
+        return loadEmbeddedBytecode(ctx, embeddedBytecode[index], embeddedBytecodeLength[index]);
+    }
+
+    return loadEmbeddedScript(ctx, (char *)embeddedScriptSource(index));
+}
+
+#ifdef BITSYBOX_HOST
+int hostCompileEngine(const char *path)
+{
+    FILE *file = fopen(path, "w");
+    if (file == NULL)
+    {
+        fprintf(stderr, "compile: failed to open output: %s\n", path);
+        return 1;
+    }
+
+    duk_context *ctx = duk_create_heap_default();
+    int status = 0;
+
+    fprintf(file, "#ifndef BYTECODE_H\n#define BYTECODE_H\n\n");
+    fprintf(file, "// generated by `program --compile-engine` (host build) from engine.h and boot.h\n");
+    fprintf(file, "// with this copy of Duktape and duk_config.h: rerun it after changing any of them\n\n");
+    fprintf(file, "#define EMBEDDED_BYTECODE_COUNT %d\n", EMBEDDED_SCRIPT_COUNT);
+    fprintf(file, "#define EMBEDDED_BYTECODE_SOURCE_HASH 0x%08lxUL\n\n", (unsigned long)hashEmbeddedScripts());
+
+    size_t lengths[EMBEDDED_SCRIPT_COUNT];
+
+    for (int i = 0; i < EMBEDDED_SCRIPT_COUNT && status == 0; i++)
+    {
+        const char *source = embeddedScriptSource(i);
+
+        duk_push_string(ctx, embeddedScriptNames[i]);
+        if (duk_pcompile_lstring_filename(ctx, 0, source, strlen(source)) != 0)
+        {
+            fprintf(stderr, "compile: %s: %s\n", embeddedScriptNames[i], duk_safe_to_string(ctx, -1));
+            status = 1;
+            break;
+        }
+
+        duk_dump_function(ctx);
+
+        duk_size_t length = 0;
+        const uint8_t *data = (const uint8_t *)duk_get_buffer_data(ctx, -1, &length);
+        lengths[i] = length;
+
+        fprintf(file, "// %s\nstatic const uint8_t embeddedBytecode%d[] = {", embeddedScriptNames[i], i);
+        for (duk_size_t j = 0; j < length; j++)
+        {
+            fprintf(file, "%s0x%02x,", (j % 16) == 0 ? "\n\t" : " ", data[j]);
+        }
+        fprintf(file, "\n};\n\n");
+
+        printf("%s: %lu bytes of source, %lu bytes of bytecode\n", embeddedScriptNames[i],
+               (unsigned long)strlen(source), (unsigned long)length);
+
+        duk_pop(ctx);
+    }
+
+    if (status == 0)
+    {
+        fprintf(file, "static const uint8_t *const embeddedBytecode[] = {\n");
+        for (int i = 0; i < EMBEDDED_SCRIPT_COUNT; i++)
+        {
+            fprintf(file, "\tembeddedBytecode%d,\n", i);
+        }
+        fprintf(file, "};\n\nstatic const size_t embeddedBytecodeLength[] = {\n");
+        for (int i = 0; i < EMBEDDED_SCRIPT_COUNT; i++)
+        {
+            fprintf(file, "\t%lu,\n", (unsigned long)lengths[i]);
+        }
+        fprintf(file, "};\n\n#endif\n");
+    }
+
+    fclose(file);
+    duk_destroy_heap(ctx);
+
+    return status;
+}
+#endif
+#endif
+
 /* Bitsy System APIs */
 duk_ret_t bitsyLog(duk_context *ctx)
 {
@@ -253,6 +495,23 @@ duk_ret_t bitsySetGraphicsMode(duk_context *ctx)
     return 0;
 }
 
+// only a real change moves the generations, so rewriting the same color is free
+void setPaletteColor(int paletteIndex, uint8_t r, uint8_t g, uint8_t b)
+{
+    if (paletteIndex < 0 || paletteIndex >= SYSTEM_PALETTE_MAX)
+    {
+        return;
+    }
+
+    uint16_t color = tft.color565(r, g, b);
+
+    if (systemPalette[paletteIndex] != color)
+    {
+        systemPalette[paletteIndex] = color;
+        systemPaletteEntryGeneration[paletteIndex] = ++systemPaletteGeneration;
+    }
+}
+
 duk_ret_t bitsySetColor(duk_context *ctx)
 {
     int paletteIndex = duk_get_int(ctx, 0);
@@ -260,7 +519,7 @@ duk_ret_t bitsySetColor(duk_context *ctx)
     int g = duk_get_int(ctx, 2);
     int b = duk_get_int(ctx, 3);
 
-    systemPalette[paletteIndex] = (Color){r, g, b};
+    setPaletteColor(paletteIndex, r, g, b);
 
     return 0;
 }
@@ -269,12 +528,122 @@ duk_ret_t bitsyResetColors(duk_context *ctx)
 {
     for (int i = 0; i < SYSTEM_PALETTE_MAX; i++)
     {
-        systemPalette[i] = (Color){0, 0, 0};
+        setPaletteColor(i, 0, 0, 0);
     }
 
     return 0;
 }
 
+// the screen or textbox buffer selected with bitsyDrawBegin(), or NULL (tiles are
+// drawn through currentTile() instead)
+static TFT_eSprite *currentBuffer()
+{
+    if (curBufferId == screenBufferId || curBufferId == textboxBufferId)
+    {
+        return drawingBuffers[curBufferId];
+    }
+
+    return NULL;
+}
+
+static TileAtlasEntry *currentTile()
+{
+    if (curBufferId >= tileStartBufferId && curBufferId < nextBufferId)
+    {
+        return &tileAtlas[curBufferId];
+    }
+
+    return NULL;
+}
+
+// expand an atlas tile into an indexed pixel buffer at a pixel position (tile
+// aligned positions never need clipping, but sprites drawn by hacks might)
+static void expandTile(const TileAtlasEntry *tile, uint8_t *pixels, int width, int height, int x, int y)
+{
+    if (x < 0 || y < 0 || x + TILE_ATLAS_ROWS > width || y + TILE_ATLAS_ROWS > height)
+    {
+        for (int row = 0; row < TILE_ATLAS_ROWS; row++)
+        {
+            for (int col = 0; col < TILE_ATLAS_ROWS; col++)
+            {
+                int px = x + col;
+                int py = y + row;
+                if (px >= 0 && py >= 0 && px < width && py < height)
+                {
+                    pixels[(py * width) + px] = (tile->bits[row] & (0x80 >> col)) ? tile->fg : tile->bg;
+                }
+            }
+        }
+    }
+    else
+    {
+        const uint8_t colors[2] = {tile->bg, tile->fg};
+        uint8_t *dst = pixels + (y * width) + x;
+
+        for (int row = 0; row < TILE_ATLAS_ROWS; row++, dst += width)
+        {
+            uint8_t bits = tile->bits[row];
+            for (int col = 0; col < TILE_ATLAS_ROWS; col++)
+            {
+                dst[col] = colors[(bits >> (7 - col)) & 1];
+            }
+        }
+    }
+}
+
+// note that a pixel rect of the screen buffer was drawn over: the display sends it, and
+// the next bitsyDrawRoom() restores the room layer under it
+static void markScreenDrawn(int x, int y, int w, int h)
+{
+    displayMarkDirty(x, y, w, h);
+
+    int left = max(0, x / tileSize);
+    int top = max(0, y / tileSize);
+    int right = min(ROOM_LAYER_CELLS - 1, (x + w - 1) / tileSize);
+    int bottom = min(ROOM_LAYER_CELLS - 1, (y + h - 1) / tileSize);
+
+    for (int row = top; row <= bottom; row++)
+    {
+        for (int col = left; col <= right; col++)
+        {
+            isScreenCellCovered[row][col] = true;
+        }
+    }
+}
+
+static void blitTile(const TileAtlasEntry *tile, int x, int y)
+{
+    TFT_eSprite *screen = drawingBuffers[screenBufferId];
+    expandTile(tile, (uint8_t *)screen->getPointer(), screen->width(), screen->height(), x, y);
+
+    markScreenDrawn(x, y, TILE_ATLAS_ROWS, TILE_ATLAS_ROWS);
+    profileCount(PROFILE_TILE_BLITS, 1);
+}
+
+// opaque copy of one indexed buffer into another, clipped to the destination
+static void blitBuffer(TFT_eSprite *src, TFT_eSprite *dst, int x, int y)
+{
+    const uint8_t *srcPixels = (const uint8_t *)src->getPointer();
+    uint8_t *dstPixels = (uint8_t *)dst->getPointer();
+    if (srcPixels == NULL || dstPixels == NULL)
+    {
+        return;
+    }
+
+    int srcWidth = src->width();
+    int dstWidth = dst->width();
+
+    int left = max(0, -x);
+    int top = max(0, -y);
+    int right = min(srcWidth, dstWidth - x);
+    int bottom = min((int)src->height(), (int)dst->height() - y);
+
+    for (int row = top; row < bottom; row++)
+    {
+        memcpy(dstPixels + ((y + row) * dstWidth) + x + left, srcPixels + (row * srcWidth) + left, right - left);
+    }
+}
+
 duk_ret_t bitsyDrawBegin(duk_context *ctx)
 {
     curBufferId = duk_get_int(ctx, 0);
@@ -293,9 +662,48 @@ duk_ret_t bitsyDrawPixel(duk_context *ctx)
     int x = duk_get_int(ctx, 1);
     int y = duk_get_int(ctx, 2);
 
-    Color color = systemPalette[paletteIndex];
+    TileAtlasEntry *tile = currentTile();
+    if (tile != NULL)
+    {
+        if (x < 0 || y < 0 || x >= TILE_ATLAS_ROWS || y >= TILE_ATLAS_ROWS)
+        {
+            return 0;
+        }
+
+        tileAtlasGeneration++;
+
+        // background clears the bit; any other color sets it and becomes the
+        // foreground for the whole tile
+        if (paletteIndex == tile->bg)
+        {
+            tile->bits[y] &= ~(0x80 >> x);
+        }
+        else
+        {
+            tile->bits[y] |= (0x80 >> x);
+            tile->fg = (uint8_t)paletteIndex;
+        }
+
+        return 0;
+    }
+
+    TFT_eSprite *buffer = currentBuffer();
+    if (buffer == NULL)
+    {
+        return 0;
+    }
+
+    if (x < 0 || y < 0 || x >= buffer->width() || y >= buffer->height())
+    {
+        return 0;
+    }
 
-    tft.drawPixel(x, y, tft.color565(color.r, color.g, color.b));
+    ((uint8_t *)buffer->getPointer())[(y * buffer->width()) + x] = (uint8_t)paletteIndex;
+
+    if (curBufferId == screenBufferId)
+    {
+        markScreenDrawn(x, y, 1, 1);
+    }
 
     return 0;
 }
@@ -317,101 +725,585 @@ duk_ret_t bitsyDrawTile(duk_context *ctx)
         return 0;
     }
 
-    // Copy sprite from drawingBuffers
-    drawingBuffers[tileId]->pushSprite(x, y);
+    // Copy tile into the screen buffer (x, y are in tiles)
+    blitTile(&tileAtlas[tileId], x * tileSize, y * tileSize);
 
     return 0;
 }
 
-duk_ret_t bitsyDrawTextbox(duk_context *ctx)
+// (tileIds, backgroundIndex) draw a whole room of tiles into the screen buffer: tileIds
+// holds one tile buffer id per cell (row by row, roomSize x roomSize), 0 for an empty
+// cell showing the background color. Goes through the room layer, so only cells that
+// changed or were drawn over since the last call are written.
+duk_ret_t bitsyDrawRoom(duk_context *ctx)
 {
-    if (curBufferId != 0 || curGraphicsMode != 1)
+    if (curBufferId != screenBufferId || curGraphicsMode != 1 || roomSize != ROOM_LAYER_CELLS ||
+        screenSize != ROOM_LAYER_CELLS * tileSize)
     {
         return 0;
     }
 
-    int x = duk_get_int(ctx, 0);
-    int y = duk_get_int(ctx, 1);
-
-    // Copy textbox buffer to screen buffer
-    drawingBuffers[1]->pushSprite(x, y);
-
-    return 0;
-}
-
-duk_ret_t bitsyClear(duk_context *ctx)
-{
-    int paletteIndex = duk_get_int(ctx, 0);
-
-    Color color = systemPalette[paletteIndex];
-
-    if (curBufferId == 0)
+    duk_size_t length = 0;
+    const uint16_t *tileIds = (const uint16_t *)duk_get_buffer_data(ctx, 0, &length);
+    int background = duk_get_int(ctx, 1);
+    if (tileIds == NULL)
     {
-        // Clear the screen buffer
-        tft.fillScreen(tft.color565(color.r, color.g, color.b));
+        return 0;
     }
-    else if (curBufferId == 1)
+
+    if (roomLayer == NULL)
     {
-        // Clear the textbox buffer
-        tft.fillRect(0, 0, textboxWidth, textboxHeight, tft.color565(color.r, color.g, color.b));
+        roomLayer = (uint8_t *)malloc(screenSize * screenSize);
+        if (roomLayer == NULL)
+        {
+            return 0;
+        }
     }
-    else if (curBufferId >= tileStartBufferId && curBufferId < nextBufferId)
+
+    // tiles were redrawn or the background changed: every cell is expanded again
+    if (!isRoomLayerValid || roomLayerAtlasGeneration != tileAtlasGeneration || roomLayerBackground != background)
     {
-        // Clear the tile buffer
-        tft.fillRect(0, 0, tileSize, tileSize, tft.color565(color.r, color.g, color.b));
+        memset(roomLayerTileIds, 0xFF, sizeof(roomLayerTileIds));
+        roomLayerAtlasGeneration = tileAtlasGeneration;
+        roomLayerBackground = background;
+        isRoomLayerValid = true;
     }
 
-    return 0;
-}
+    int cellCount = min((int)(length / sizeof(uint16_t)), ROOM_LAYER_CELLS * ROOM_LAYER_CELLS);
+    uint8_t *screen = (uint8_t *)drawingBuffers[screenBufferId]->getPointer();
 
-duk_ret_t bitsyAddTile(duk_context *ctx)
-{
-    if (nextBufferId >= SYSTEM_DRAWING_BUFFER_MAX)
+    // the whole room is drawn in this frame's palette, even the cells left as they were
+    displayMarkDrawn();
+
+    for (int i = 0; i < ROOM_LAYER_CELLS * ROOM_LAYER_CELLS; i++)
     {
-        // todo : error handling?
-        return 0;
-    }
+        int col = i % ROOM_LAYER_CELLS;
+        int row = i / ROOM_LAYER_CELLS;
+        int x = col * tileSize;
+        int y = row * tileSize;
 
-    auto newTile = new TFT_eSprite(&tft);
-    newTile->createSprite(tileSize, tileSize);
-    drawingBuffers[nextBufferId] = newTile;
+        int tileId = i < cellCount ? tileIds[i] : 0;
+        if (tileId < tileStartBufferId || tileId >= nextBufferId)
+        {
+            tileId = 0;
+        }
 
-    duk_push_int(ctx, nextBufferId);
+        bool isChanged = roomLayerTileIds[i] != tileId;
 
-    nextBufferId++;
+        if (isChanged)
+        {
+            if (tileId != 0)
+            {
+                expandTile(&tileAtlas[tileId], roomLayer, screenSize, screenSize, x, y);
+                profileCount(PROFILE_TILE_BLITS, 1);
+            }
+            else
+            {
+                for (int py = y; py < y + tileSize; py++)
+                {
+                    memset(roomLayer + (py * screenSize) + x, (uint8_t)background, tileSize);
+                }
+            }
 
-    return 1;
-}
+            roomLayerTileIds[i] = (uint16_t)tileId;
+        }
 
-duk_ret_t bitsyResetTiles(duk_context *ctx)
-{
-    nextBufferId = tileStartBufferId;
+        if (isChanged || isScreenCellCovered[row][col])
+        {
+            for (int py = y; py < y + tileSize; py++)
+            {
+                memcpy(screen + (py * screenSize) + x, roomLayer + (py * screenSize) + x, tileSize);
+            }
+
+            isScreenCellCovered[row][col] = false;
+            displayMarkDirty(x, y, tileSize, tileSize);
+        }
+    }
 
     return 0;
 }
 
-duk_ret_t bitsySetTextboxSize(duk_context *ctx)
+// fill a whole tile buffer from a packed 1-bit bitmap: one byte per row (tiles are
+// 8 pixels wide), most significant bit on the left. bits may be a buffer / typed
+// array or a plain array of row values.
+duk_ret_t bitsyDrawTileData(duk_context *ctx)
 {
-    textboxWidth = duk_get_int(ctx, 0);
-    textboxHeight = duk_get_int(ctx, 1);
+    int tileId = duk_get_int(ctx, 0);
+    int fg = duk_get_int(ctx, 2);
+    int bg = duk_get_int(ctx, 3);
 
-    drawingBuffers[1]->deleteSprite();
-    drawingBuffers[1]->createSprite(textboxWidth, textboxHeight);
+    if (tileId < tileStartBufferId || tileId >= nextBufferId)
+    {
+        return 0;
+    }
+
+    TileAtlasEntry *tile = &tileAtlas[tileId];
+    tileAtlasGeneration++;
+    memset(tile->bits, 0, sizeof(tile->bits));
+    tile->fg = (uint8_t)fg;
+    tile->bg = (uint8_t)bg;
+
+    if (duk_is_buffer_data(ctx, 1))
+    {
+        duk_size_t length = 0;
+        const uint8_t *data = (const uint8_t *)duk_get_buffer_data(ctx, 1, &length);
+        memcpy(tile->bits, data, min((int)length, TILE_ATLAS_ROWS));
+    }
+    else if (duk_is_array(ctx, 1))
+    {
+        for (int y = 0; y < TILE_ATLAS_ROWS; y++)
+        {
+            duk_get_prop_index(ctx, 1, y);
+            tile->bits[y] = (uint8_t)duk_get_int(ctx, -1);
+            duk_pop(ctx);
+        }
+    }
 
     return 0;
 }
 
-duk_ret_t bitsyOnLoad(duk_context *ctx)
+// snapshot for a handle argument, or NULL if the handle was never rasterized
+static const uint8_t *getSnapshot(duk_context *ctx, duk_idx_t idx)
 {
-    // hacky to just stick it in the global namespace??
-    duk_put_global_string(ctx, "__bitsybox_on_load__");
+    int handle = duk_get_int(ctx, idx);
+    if (handle < 0 || handle >= ROOM_SNAPSHOT_MAX)
+    {
+        return NULL;
+    }
 
-    return 0;
+    return roomSnapshots[handle];
 }
 
-duk_ret_t bitsyOnQuit(duk_context *ctx)
+// rasterize a room into a snapshot, as drawRoom() would draw it on the screen:
+// (handle, backgroundIndex, tileIds, drawTiles) where tileIds is laid out as for
+// bitsyDrawRoom() and drawTiles holds (tile buffer id, x, y) triples (in tiles) for
+// the items and sprites drawn over them, in order
+duk_ret_t bitsySnapshotRoom(duk_context *ctx)
 {
-    duk_put_global_string(ctx, "__bitsybox_on_quit__");
+    int handle = duk_get_int(ctx, 0);
+    int backgroundIndex = duk_get_int(ctx, 1);
+
+    if (handle < 0 || handle >= ROOM_SNAPSHOT_MAX)
+    {
+        return 0;
+    }
+
+    if (roomSnapshots[handle] == NULL)
+    {
+        roomSnapshots[handle] = (uint8_t *)malloc(screenSize * screenSize);
+        if (roomSnapshots[handle] == NULL)
+        {
+            return 0;
+        }
+    }
+
+    uint8_t *pixels = roomSnapshots[handle];
+    memset(pixels, backgroundIndex, screenSize * screenSize);
+
+    duk_size_t length = 0;
+    const uint16_t *tileIds = (const uint16_t *)duk_get_buffer_data(ctx, 2, &length);
+    int cellCount = tileIds != NULL ? min((int)(length / sizeof(uint16_t)), roomSize * roomSize) : 0;
+
+    for (int i = 0; i < cellCount; i++)
+    {
+        if (tileIds[i] >= tileStartBufferId && tileIds[i] < nextBufferId)
+        {
+            expandTile(&tileAtlas[tileIds[i]], pixels, screenSize, screenSize, (i % roomSize) * tileSize, (i / roomSize) * tileSize);
+        }
+    }
+
+    const uint16_t *drawTiles = (const uint16_t *)duk_get_buffer_data(ctx, 3, &length);
+    int drawCount = drawTiles != NULL ? (int)(length / (3 * sizeof(uint16_t))) : 0;
+
+    for (int i = 0; i < drawCount; i++, drawTiles += 3)
+    {
+        if (drawTiles[0] >= tileStartBufferId && drawTiles[0] < nextBufferId)
+        {
+            expandTile(&tileAtlas[drawTiles[0]], pixels, screenSize, screenSize, drawTiles[1] * tileSize, drawTiles[2] * tileSize);
+        }
+    }
+
+    duk_push_true(ctx);
+    return 1;
+}
+
+// (handle, x, y) palette index of one snapshot pixel, for effects drawn in JS
+duk_ret_t bitsyGetSnapshotPixel(duk_context *ctx)
+{
+    const uint8_t *pixels = getSnapshot(ctx, 0);
+    int x = duk_get_int(ctx, 1);
+    int y = duk_get_int(ctx, 2);
+
+    if (pixels == NULL || x < 0 || y < 0 || x >= screenSize || y >= screenSize)
+    {
+        return 0;
+    }
+
+    duk_push_int(ctx, pixels[(y * screenSize) + x]);
+    return 1;
+}
+
+duk_ret_t bitsyReleaseSnapshot(duk_context *ctx)
+{
+    int handle = duk_get_int(ctx, 0);
+
+    if (handle >= 0 && handle < ROOM_SNAPSHOT_MAX)
+    {
+        free(roomSnapshots[handle]);
+        roomSnapshots[handle] = NULL;
+    }
+
+    return 0;
+}
+
+// draw one frame of a room transition into the screen buffer natively:
+// (effectName, delta, startSnapshot, startCenterX, startCenterY, endSnapshot, endCenterX, endCenterY)
+// returns false if there is no native kernel for the effect
+duk_ret_t bitsyDrawTransition(duk_context *ctx)
+{
+    TransitionEffect effect = transitionFindEffect(duk_get_string(ctx, 0));
+    double delta = duk_get_number(ctx, 1);
+
+    TransitionImage start = {getSnapshot(ctx, 2), duk_get_int(ctx, 3), duk_get_int(ctx, 4)};
+    TransitionImage end = {getSnapshot(ctx, 5), duk_get_int(ctx, 6), duk_get_int(ctx, 7)};
+
+    bool isDrawn = effect != TRANSITION_NONE && curBufferId == screenBufferId && screenSize == TRANSITION_SIZE &&
+                   start.pixels != NULL && end.pixels != NULL;
+
+    if (isDrawn)
+    {
+        transitionDraw(effect, start, end, delta, (uint8_t *)drawingBuffers[screenBufferId]->getPointer());
+        markScreenDrawn(0, 0, screenSize, screenSize);
+    }
+
+    duk_push_boolean(ctx, isDrawn);
+    return 1;
+}
+
+// (width, height, bits) add a glyph to the table, bits packed as in glyphData
+// (a buffer / typed array). returns the glyph id, or -1 once the table is full
+duk_ret_t bitsyAddGlyph(duk_context *ctx)
+{
+    int width = duk_get_int(ctx, 0);
+    int height = duk_get_int(ctx, 1);
+    int size = ((width + 7) / 8) * height;
+
+    duk_size_t length = 0;
+    const uint8_t *bits = (const uint8_t *)duk_get_buffer_data(ctx, 2, &length);
+
+    if (bits == NULL || width <= 0 || height <= 0 || width > 255 || height > 255 || (int)length < size ||
+        glyphCount >= GLYPH_MAX || glyphDataUsed + size > GLYPH_DATA_MAX)
+    {
+        duk_push_int(ctx, -1);
+        return 1;
+    }
+
+    glyphs[glyphCount] = (GlyphEntry){glyphData + glyphDataUsed, (uint8_t)width, (uint8_t)height};
+    memcpy(glyphData + glyphDataUsed, bits, size);
+    glyphDataUsed += size;
+
+    duk_push_int(ctx, glyphCount++);
+    return 1;
+}
+
+duk_ret_t bitsyResetGlyphs(duk_context *ctx)
+{
+    glyphCount = 0;
+    glyphDataUsed = 0;
+
+    return 0;
+}
+
+// look up a table or baked glyph id
+static bool getGlyph(int glyphId, GlyphEntry *glyph)
+{
+    if (glyphId >= 0 && glyphId < glyphCount)
+    {
+        *glyph = glyphs[glyphId];
+        return true;
+    }
+
+    int fontIndex = (glyphId >> GLYPH_BAKED_SHIFT) - 1;
+    int charIndex = glyphId & ((1 << GLYPH_BAKED_SHIFT) - 1);
+
+    if (fontIndex < 0 || fontIndex >= (int)(sizeof(bakedFonts) / sizeof(bakedFonts[0])) ||
+        charIndex >= (int)bakedFonts[fontIndex].charCount)
+    {
+        return false;
+    }
+
+    const BakedFont *font = &bakedFonts[fontIndex];
+    const BakedFontChar *c = &font->chars[charIndex];
+    *glyph = (GlyphEntry){font->bits + c->bitsOffset, c->width, c->height};
+
+    return true;
+}
+
+// (glyphId, x, y, colorIndex) draw the set bits of a glyph into the current buffer
+duk_ret_t bitsyDrawGlyph(duk_context *ctx)
+{
+    int glyphId = duk_get_int(ctx, 0);
+    int x = duk_get_int(ctx, 1);
+    int y = duk_get_int(ctx, 2);
+    uint8_t colorIndex = (uint8_t)duk_get_int(ctx, 3);
+
+    GlyphEntry glyph;
+    TFT_eSprite *buffer = currentBuffer();
+    if (buffer == NULL || !getGlyph(glyphId, &glyph))
+    {
+        return 0;
+    }
+
+    uint8_t *pixels = (uint8_t *)buffer->getPointer();
+    int width = buffer->width();
+    int height = buffer->height();
+    int stride = (glyph.width + 7) / 8;
+
+    int left = max(0, -x);
+    int top = max(0, -y);
+    int right = min((int)glyph.width, width - x);
+    int bottom = min((int)glyph.height, height - y);
+
+    for (int row = top; row < bottom; row++)
+    {
+        const uint8_t *bits = glyph.bits + (row * stride);
+        uint8_t *dst = pixels + ((y + row) * width) + x;
+
+        for (int col = left; col < right; col++)
+        {
+            if (bits[col >> 3] & (0x80 >> (col & 7)))
+            {
+                dst[col] = colorIndex;
+            }
+        }
+    }
+
+    if (curBufferId == screenBufferId && right > left && bottom > top)
+    {
+        markScreenDrawn(x + left, y + top, right - left, bottom - top);
+    }
+
+    return 0;
+}
+
+// (name) { id, width, height } of a font baked into font.h, or null
+duk_ret_t bitsyGetBakedFont(duk_context *ctx)
+{
+    const char *name = duk_get_string(ctx, 0);
+
+    for (int i = 0; name != NULL && i < (int)(sizeof(bakedFonts) / sizeof(bakedFonts[0])); i++)
+    {
+        if (strcmp(name, bakedFonts[i].name) == 0)
+        {
+            duk_idx_t obj = duk_push_object(ctx);
+            duk_push_int(ctx, i);
+            duk_put_prop_string(ctx, obj, "id");
+            duk_push_int(ctx, bakedFonts[i].width);
+            duk_put_prop_string(ctx, obj, "width");
+            duk_push_int(ctx, bakedFonts[i].height);
+            duk_put_prop_string(ctx, obj, "height");
+            return 1;
+        }
+    }
+
+    duk_push_null(ctx);
+    return 1;
+}
+
+// (fontId, codepoint) char data of a baked font in the shape Font.getChar() returns,
+// with a glyphId for bitsyDrawGlyph() instead of the bitmap array; null if missing
+duk_ret_t bitsyGetBakedChar(duk_context *ctx)
+{
+    int fontId = duk_get_int(ctx, 0);
+    uint32_t codepoint = (uint32_t)duk_get_uint(ctx, 1);
+
+    if (fontId < 0 || fontId >= (int)(sizeof(bakedFonts) / sizeof(bakedFonts[0])))
+    {
+        duk_push_null(ctx);
+        return 1;
+    }
+
+    const BakedFont *font = &bakedFonts[fontId];
+    const BakedFontChar *c = std::lower_bound(font->chars, font->chars + font->charCount, codepoint,
+                                              [](const BakedFontChar &a, uint32_t b) { return a.codepoint < b; });
+
+    if (c == font->chars + font->charCount || c->codepoint != codepoint)
+    {
+        duk_push_null(ctx);
+        return 1;
+    }
+
+    duk_idx_t obj = duk_push_object(ctx);
+    duk_push_int(ctx, c->width);
+    duk_put_prop_string(ctx, obj, "width");
+    duk_push_int(ctx, c->height);
+    duk_put_prop_string(ctx, obj, "height");
+
+    duk_idx_t offset = duk_push_object(ctx);
+    duk_push_int(ctx, c->offsetX);
+    duk_put_prop_string(ctx, offset, "x");
+    duk_push_int(ctx, c->offsetY);
+    duk_put_prop_string(ctx, offset, "y");
+    duk_put_prop_string(ctx, obj, "offset");
+
+    duk_push_int(ctx, c->spacing);
+    duk_put_prop_string(ctx, obj, "spacing");
+    duk_push_null(ctx);
+    duk_put_prop_string(ctx, obj, "data");
+    duk_push_int(ctx, ((fontId + 1) << GLYPH_BAKED_SHIFT) + (int)(c - font->chars));
+    duk_put_prop_string(ctx, obj, "glyphId");
+
+    return 1;
+}
+
+// (fontId) array of every codepoint in a baked font
+duk_ret_t bitsyGetBakedCharCodes(duk_context *ctx)
+{
+    int fontId = duk_get_int(ctx, 0);
+    duk_idx_t arr = duk_push_array(ctx);
+
+    if (fontId >= 0 && fontId < (int)(sizeof(bakedFonts) / sizeof(bakedFonts[0])))
+    {
+        for (uint32_t i = 0; i < bakedFonts[fontId].charCount; i++)
+        {
+            duk_push_uint(ctx, bakedFonts[fontId].chars[i].codepoint);
+            duk_put_prop_index(ctx, arr, i);
+        }
+    }
+
+    return 1;
+}
+
+duk_ret_t bitsyDrawTextbox(duk_context *ctx)
+{
+    if (curBufferId != 0 || curGraphicsMode != 1)
+    {
+        return 0;
+    }
+
+    int x = duk_get_int(ctx, 0);
+    int y = duk_get_int(ctx, 1);
+
+    // Copy textbox buffer to screen buffer
+    blitBuffer(drawingBuffers[textboxBufferId], drawingBuffers[screenBufferId], x, y);
+    markScreenDrawn(x, y, textboxWidth, textboxHeight);
+
+    return 0;
+}
+
+// (paletteIndex[, x, y, w, h]) fill the current buffer, or only a rect of the screen /
+// textbox buffer when one is given
+duk_ret_t bitsyClear(duk_context *ctx)
+{
+    int paletteIndex = duk_get_int(ctx, 0);
+
+    TileAtlasEntry *tile = currentTile();
+    if (tile != NULL)
+    {
+        tileAtlasGeneration++;
+        memset(tile->bits, 0, sizeof(tile->bits));
+        tile->bg = (uint8_t)paletteIndex;
+        return 0;
+    }
+
+    TFT_eSprite *buffer = currentBuffer();
+    if (buffer == NULL)
+    {
+        return 0;
+    }
+
+    int width = buffer->width();
+    int height = buffer->height();
+
+    int left = 0;
+    int top = 0;
+    int right = width;
+    int bottom = height;
+
+    if (duk_is_number(ctx, 1))
+    {
+        left = max(0, duk_get_int(ctx, 1));
+        top = max(0, duk_get_int(ctx, 2));
+        right = min(width, duk_get_int(ctx, 1) + duk_get_int(ctx, 3));
+        bottom = min(height, duk_get_int(ctx, 2) + duk_get_int(ctx, 4));
+    }
+
+    if (right <= left || bottom <= top)
+    {
+        return 0;
+    }
+
+    uint8_t *pixels = (uint8_t *)buffer->getPointer();
+
+    if (left == 0 && right == width)
+    {
+        memset(pixels + (top * width), (uint8_t)paletteIndex, width * (bottom - top));
+    }
+    else
+    {
+        for (int row = top; row < bottom; row++)
+        {
+            memset(pixels + (row * width) + left, (uint8_t)paletteIndex, right - left);
+        }
+    }
+
+    if (curBufferId == screenBufferId)
+    {
+        markScreenDrawn(left, top, right - left, bottom - top);
+    }
+
+    return 0;
+}
+
+duk_ret_t bitsyAddTile(duk_context *ctx)
+{
+    if (nextBufferId >= SYSTEM_DRAWING_BUFFER_MAX)
+    {
+        // todo : error handling?
+        return 0;
+    }
+
+    // atlas entries are reused after bitsyResetTiles(), so nothing is allocated here
+    memset(&tileAtlas[nextBufferId], 0, sizeof(TileAtlasEntry));
+    tileAtlasGeneration++;
+
+    duk_push_int(ctx, nextBufferId);
+
+    nextBufferId++;
+
+    return 1;
+}
+
+duk_ret_t bitsyResetTiles(duk_context *ctx)
+{
+    nextBufferId = tileStartBufferId;
+    tileAtlasGeneration++;
+
+    return 0;
+}
+
+duk_ret_t bitsySetTextboxSize(duk_context *ctx)
+{
+    textboxWidth = duk_get_int(ctx, 0);
+    textboxHeight = duk_get_int(ctx, 1);
+
+    drawingBuffers[1]->deleteSprite();
+    drawingBuffers[1]->createSprite(textboxWidth, textboxHeight);
+
+    return 0;
+}
+
+duk_ret_t bitsyOnLoad(duk_context *ctx)
+{
+    // hacky to just stick it in the global namespace??
+    duk_put_global_string(ctx, "__bitsybox_on_load__");
+
+    return 0;
+}
+
+duk_ret_t bitsyOnQuit(duk_context *ctx)
+{
+    duk_put_global_string(ctx, "__bitsybox_on_quit__");
 
     return 0;
 }
@@ -423,6 +1315,23 @@ duk_ret_t bitsyOnUpdate(duk_context *ctx)
     return 0;
 }
 
+#ifdef BITSYBOX_HOST
+/* Host System APIs */
+// engine time and randomness go through the Arduino clock and RNG so host runs
+// can use the virtual clock and replay deterministically
+duk_ret_t hostDateNow(duk_context *ctx)
+{
+    duk_push_number(ctx, (duk_double_t)millis());
+    return 1;
+}
+
+duk_ret_t hostMathRandom(duk_context *ctx)
+{
+    duk_push_number(ctx, (duk_double_t)random(0x7FFFFFFF) / 2147483648.0);
+    return 1;
+}
+#endif
+
 static void fatalError(void *udata, const char *msg)
 {
     Serial.printf("*** FATAL ERROR: %s\n", (msg ? msg : "no message"));
@@ -459,10 +1368,46 @@ void initBitsySystem(duk_context *ctx)
     duk_push_c_function(ctx, bitsyDrawTile, 3);
     duk_put_global_string(ctx, "bitsyDrawTile");
 
+    duk_push_c_function(ctx, bitsyDrawRoom, 2);
+    duk_put_global_string(ctx, "bitsyDrawRoom");
+
+    duk_push_c_function(ctx, bitsyDrawTileData, 4);
+    duk_put_global_string(ctx, "bitsyDrawTileData");
+
+    duk_push_c_function(ctx, bitsySnapshotRoom, 4);
+    duk_put_global_string(ctx, "bitsySnapshotRoom");
+
+    duk_push_c_function(ctx, bitsyGetSnapshotPixel, 3);
+    duk_put_global_string(ctx, "bitsyGetSnapshotPixel");
+
+    duk_push_c_function(ctx, bitsyReleaseSnapshot, 1);
+    duk_put_global_string(ctx, "bitsyReleaseSnapshot");
+
+    duk_push_c_function(ctx, bitsyDrawTransition, 8);
+    duk_put_global_string(ctx, "bitsyDrawTransition");
+
+    duk_push_c_function(ctx, bitsyAddGlyph, 3);
+    duk_put_global_string(ctx, "bitsyAddGlyph");
+
+    duk_push_c_function(ctx, bitsyResetGlyphs, 0);
+    duk_put_global_string(ctx, "bitsyResetGlyphs");
+
+    duk_push_c_function(ctx, bitsyDrawGlyph, 4);
+    duk_put_global_string(ctx, "bitsyDrawGlyph");
+
+    duk_push_c_function(ctx, bitsyGetBakedFont, 1);
+    duk_put_global_string(ctx, "bitsyGetBakedFont");
+
+    duk_push_c_function(ctx, bitsyGetBakedChar, 2);
+    duk_put_global_string(ctx, "bitsyGetBakedChar");
+
+    duk_push_c_function(ctx, bitsyGetBakedCharCodes, 1);
+    duk_put_global_string(ctx, "bitsyGetBakedCharCodes");
+
     duk_push_c_function(ctx, bitsyDrawTextbox, 2);
     duk_put_global_string(ctx, "bitsyDrawTextbox");
 
-    duk_push_c_function(ctx, bitsyClear, 1);
+    duk_push_c_function(ctx, bitsyClear, 5);
     duk_put_global_string(ctx, "bitsyClear");
 
     duk_push_c_function(ctx, bitsyAddTile, 0);
@@ -482,6 +1427,18 @@ void initBitsySystem(duk_context *ctx)
 
     duk_push_c_function(ctx, bitsyOnUpdate, 1);
     duk_put_global_string(ctx, "bitsyOnUpdate");
+
+#ifdef BITSYBOX_HOST
+    duk_get_global_string(ctx, "Date");
+    duk_push_c_function(ctx, hostDateNow, 0);
+    duk_put_prop_string(ctx, -2, "now");
+    duk_pop(ctx);
+
+    duk_get_global_string(ctx, "Math");
+    duk_push_c_function(ctx, hostMathRandom, 0);
+    duk_put_prop_string(ctx, -2, "random");
+    duk_pop(ctx);
+#endif
 }
 
 void loadEngine(duk_context *ctx)
@@ -498,23 +1455,262 @@ void loadEngine(duk_context *ctx)
     shouldContinue = shouldContinue && loadFile(ctx, "bitsy/font/ascii_small.bitsyfont", "__bitsybox_default_font__");
 #else
     // load engine
-    shouldContinue = shouldContinue && loadEmbeddedScript(ctx, script_js);
-    shouldContinue = shouldContinue && loadEmbeddedScript(ctx, font_js);
-    shouldContinue = shouldContinue && loadEmbeddedScript(ctx, transition_js);
-    shouldContinue = shouldContinue && loadEmbeddedScript(ctx, dialog_js);
-    shouldContinue = shouldContinue && loadEmbeddedScript(ctx, renderer_js);
-    shouldContinue = shouldContinue && loadEmbeddedScript(ctx, bitsy_js);
-    // load default font
-    shouldContinue = shouldContinue && loadEmbeddedFile(ctx, ascii_small_bitsyfont, "__bitsybox_default_font__");
+    unsigned long loadStart = micros();
+    for (int i = 0; i < EMBEDDED_SCRIPT_BOOT; i++)
+    {
+        shouldContinue = shouldContinue && loadEmbeddedEngineScript(ctx, i);
+    }
+    Serial.printf("Engine loaded from %s in %lu us\n", isBytecodeUsable() ? "bytecode" : "source",
+                  (unsigned long)(micros() - loadStart));
+    // no default font data: FontManager falls back to the fonts baked into font.h
+    duk_push_null(ctx);
+    duk_put_global_string(ctx, "__bitsybox_default_font__");
+#endif
+}
+
+/* VM HEAP */
+// heap held by everything, the VMs included; the host's notional heap is too small
+// to hold a game, so it asks malloc instead
+uint32_t heapUsed()
+{
+#ifdef BITSYBOX_HOST
+    return (uint32_t)hostHeapUsed();
+#else
+    return ESP.getHeapSize() - ESP.getFreeHeap();
+#endif
+}
+
+// heapUsed() just before the current VM heap was created (when the pool isn't counting)
+static uint32_t vmHeapBase = 0;
+
+uint32_t vmHeapUsed(duk_context *ctx)
+{
+    // live objects only: twice, so anything a finalizer released is gone too
+    duk_gc(ctx, 0);
+    duk_gc(ctx, 0);
+
+    return poolIsEnabled() ? poolStats()->bytesInUse : heapUsed() - vmHeapBase;
+}
+
+/* SHARED VM */
+// The reset contract: after vmReset() every global is what it was right after the
+// engine loaded. resetEngine() (bitsy.js) rebuilds the engine's objects; values and
+// functions are put back from the snapshot below, and globals the snapshot doesn't
+// have (the boot menu's, the game glue's) are dropped. The built-ins and the engine's
+// functions outlive a game too, so the snapshot also lists the own properties of each
+// function global, the built-in objects and everything on their prototype chains:
+// properties a game added are deleted, and a game that replaced or removed one (or
+// froze an object) leaves a VM that can't be reset, so the next game gets a new one.
+static duk_context *sharedVm = NULL;
+
+// objects are only noted by name: the snapshot mustn't keep the first game's world
+// alive. builtins is one flat array (an array per object costs twice the memory) of
+// object, property count, then name and value for each property, with the getter as
+// the value of an accessor
+static const char *snapshotGlobalsSource =
+    "(function (global) {"
+    "  var globals = { values: {}, objects: {}, builtins: [] };"
+    "  var builtinObjects = ['Math', 'JSON', 'Reflect', 'Duktape', 'CBOR', 'performance'];"
+    "  var targets = [];"
+    "  function addTarget(target) {"
+    "    if (target === null || target === undefined || target === global || targets.indexOf(target) >= 0) { return; }"
+    "    targets.push(target);"
+    "    addTarget(Object.getPrototypeOf(target));"
+    "    if (typeof target === 'function') { addTarget(target.prototype); }"
+    "  }"
+    "  var names = Object.getOwnPropertyNames(global);"
+    "  for (var i = 0; i < names.length; i++) {"
+    "    var value = global[names[i]];"
+    "    if (value !== null && typeof value === 'object') { globals.objects[names[i]] = true; }"
+    "    else { globals.values[names[i]] = value; }"
+    "    if (typeof value === 'function' || builtinObjects.indexOf(names[i]) >= 0) { addTarget(value); }"
+    "  }"
+    "  for (var i = 0; i < targets.length; i++) {"
+    "    names = Object.getOwnPropertyNames(targets[i]);"
+    "    globals.builtins.push(targets[i], names.length);"
+    "    for (var j = 0; j < names.length; j++) {"
+    "      var descriptor = Object.getOwnPropertyDescriptor(targets[i], names[j]);"
+    "      globals.builtins.push(names[j], 'value' in descriptor ? descriptor.value : descriptor.get);"
+    "    }"
+    "  }"
+    "  Duktape.compact(globals.builtins);"
+    "  return globals;"
+    "})";
+
+// returns the number of globals dropped, or -1 if a built-in can't be put back
+static const char *resetGlobalsSource =
+    "(function (global, globals) {"
+    "  var builtins = globals.builtins;"
+    "  for (var i = 0; i < builtins.length; ) {"
+    "    var target = builtins[i];"
+    "    var end = i + 2 + (builtins[i + 1] * 2);"
+    "    var kept = Object.create(null);"
+    "    for (i += 2; i < end; i += 2) {"
+    "      var descriptor = Object.getOwnPropertyDescriptor(target, builtins[i]);"
+    "      if (descriptor === undefined) { return -1; }"
+    "      var value = 'value' in descriptor ? descriptor.value : descriptor.get;"
+    "      if (value !== builtins[i + 1] && (value === value || builtins[i + 1] === builtins[i + 1])) { return -1; }" // NaN
+    "      kept[builtins[i]] = true;"
+    "    }"
+    "    var names = Object.getOwnPropertyNames(target);"
+    "    for (var j = 0; j < names.length; j++) {"
+    "      if (kept[names[j]] !== true && !delete target[names[j]]) { return -1; }"
+    "    }"
+    "    if (!Object.isExtensible(target)) { return -1; }"
+    "  }"
+    "  resetEngine();"
+    "  var has = Object.prototype.hasOwnProperty;"
+    "  var dropped = 0;"
+    "  names = Object.getOwnPropertyNames(global);"
+    "  for (var i = 0; i < names.length; i++) {"
+    "    if (!has.call(globals.values, names[i]) && !has.call(globals.objects, names[i])) {"
+    "      if (!delete global[names[i]]) { global[names[i]] = undefined; }" // var declarations can't be deleted
+    "      dropped++;"
+    "    }"
+    "  }"
+    "  names = Object.getOwnPropertyNames(globals.values);"
+    "  for (var i = 0; i < names.length; i++) { global[names[i]] = globals.values[names[i]]; }"
+    "  return dropped;"
+    "})";
+
+static bool isVmShared()
+{
+#ifdef BITSYBOX_HOST
+    return VM_SHARED || hostOptions()->sharedVm;
+#else
+    return VM_SHARED;
 #endif
 }
 
+// keep the globals and the compiled reset function in the heap stash
+static bool snapshotGlobals(duk_context *ctx)
+{
+    duk_push_heap_stash(ctx);
+
+    bool isSnapshotTaken = duk_peval_string(ctx, snapshotGlobalsSource) == 0;
+    if (isSnapshotTaken)
+    {
+        duk_push_global_object(ctx);
+        isSnapshotTaken = duk_pcall(ctx, 1) == 0;
+    }
+    if (isSnapshotTaken)
+    {
+        duk_put_prop_string(ctx, -2, "globals");
+        isSnapshotTaken = duk_peval_string(ctx, resetGlobalsSource) == 0;
+    }
+    if (isSnapshotTaken)
+    {
+        duk_put_prop_string(ctx, -2, "resetGlobals");
+    }
+    else
+    {
+        Serial.printf("VM Snapshot Error: %s\n", duk_safe_to_string(ctx, -1));
+        duk_pop(ctx);
+    }
+
+    duk_pop(ctx);
+    return isSnapshotTaken;
+}
+
+// back to the state right after the engine loaded, see the reset contract above
+static bool vmReset(duk_context *ctx)
+{
+    unsigned long resetStart = micros();
+
+    duk_push_heap_stash(ctx);
+    duk_get_prop_string(ctx, -1, "resetGlobals");
+    duk_push_global_object(ctx);
+    duk_get_prop_string(ctx, -3, "globals");
+
+    if (duk_pcall(ctx, 2) != 0)
+    {
+        Serial.printf("VM Reset Error: %s\n", duk_safe_to_string(ctx, -1));
+        duk_pop_2(ctx);
+        return false;
+    }
+
+    int dropped = duk_get_int(ctx, -1);
+    duk_pop_2(ctx);
+
+    if (dropped < 0)
+    {
+        Serial.println("VM reset: the game changed a built-in, starting a new VM");
+        return false;
+    }
+
+    duk_gc(ctx, 0);
+    Serial.printf("VM reset in %lu us, %d globals dropped\n", (unsigned long)(micros() - resetStart), dropped);
+    return true;
+}
+
+// a heap with the engine loaded: the shared VM (already reset) or a new one
+static duk_context *vmHeapCreate()
+{
+    if (sharedVm != NULL)
+    {
+        return sharedVm;
+    }
+
+    vmHeapBase = heapUsed();
+    duk_context *ctx = duk_create_heap(poolAlloc, poolRealloc, poolFree, NULL, fatalError);
+    initBitsySystem(ctx);
+    loadEngine(ctx);
+
+    if (isVmShared() && snapshotGlobals(ctx))
+    {
+        sharedVm = ctx;
+    }
+
+    return ctx;
+}
+
+static void vmHeapDestroy(duk_context *ctx)
+{
+    // snapshots left by a transition the game quit during belong to it too
+    for (int i = 0; i < ROOM_SNAPSHOT_MAX; i++)
+    {
+        free(roomSnapshots[i]);
+        roomSnapshots[i] = NULL;
+    }
+
+    // as is the room layer, expanded again by the next game on its first room
+    free(roomLayer);
+    roomLayer = NULL;
+    isRoomLayerValid = false;
+
+    if (ctx == sharedVm)
+    {
+        if (vmReset(ctx))
+        {
+            return;
+        }
+
+        // a VM that couldn't be reset is not trusted with another game
+        sharedVm = NULL;
+    }
+
+    // the textbox is sized by the game (a reset VM keeps its size, it loads the same engine)
+    drawingBuffers[1]->deleteSprite();
+    textboxWidth = 0;
+    textboxHeight = 0;
+
+    // nothing outside the arena (and its malloc'd overflow) points into the heap and no finalizers are used,
+    // so it is dropped whole instead of object by object
+    if (poolIsArena())
+    {
+        poolRewind();
+    }
+    else
+    {
+        duk_destroy_heap(ctx);
+    }
+}
+
 void bootMenu()
 {
     tft.setTextDatum(TC_DATUM); // Align text on the screen
 
-    duk_context *ctx = duk_create_heap_default();
-    initBitsySystem(ctx);
+    duk_context *ctx = vmHeapCreate();
 
     // Load game files
     duk_peval_string(ctx, "__bitsybox_game_files__ = []");
@@ -539,21 +1735,14 @@ void bootMenu()
         }
     }
 
-    // Timing variables
-    int prevTime = millis();
-    int deltaTime = 0;
-    int loopTime = 0;
-    int loopTimeMax = 16;
     int isBootFinished = 0;
 
-    loadEngine(ctx);
-
     // Load boot menu
 #ifdef BUILD_DEBUG
     shouldContinue = shouldContinue && loadScript(ctx, "boot/boot.js");
     shouldContinue = shouldContinue && loadFile(ctx, "boot/boot.bitsy", "__bitsybox_game_data__");
 #else
-    shouldContinue = shouldContinue && loadEmbeddedScript(ctx, boot_js);
+    shouldContinue = shouldContinue && loadEmbeddedEngineScript(ctx, EMBEDDED_SCRIPT_BOOT);
     shouldContinue = shouldContinue && loadEmbeddedFile(ctx, boot_bitsy, "__bitsybox_game_data__");
 #endif
 
@@ -563,35 +1752,33 @@ void bootMenu()
     }
     duk_pop(ctx);
 
+    Serial.printf("VM heap after boot menu load: %lu bytes\n", (unsigned long)vmHeapUsed(ctx));
+
+    FramePacer pacer;
+    pacerStart(&pacer);
+
     while (shouldContinue && !isBootFinished)
     {
-        deltaTime = millis() - prevTime;
-        prevTime = millis();
-        loopTime += deltaTime;
-
         // Update input TODO: implement
 
-        if (loopTime >= loopTimeMax && shouldContinue)
-        {
-            Color bg = systemPalette[0];
-            tft.fillScreen(tft.color565(bg.r, bg.g, bg.b)); // Clear screen with background color
-
-            // main loop
-            if (duk_peval_string(ctx, "__bitsybox_on_update__();") != 0)
-            {
-                Serial.printf("Update Boot Menu Error: %s\n", duk_safe_to_string(ctx, -1));
-            }
-            duk_pop(ctx);
+        pacerWait(&pacer);
 
-            // copy screen buffer texture to screen
-            drawingBuffers[0]->pushSprite(0, 0);
+        // main loop
+        if (duk_peval_string(ctx, "__bitsybox_on_update__();") != 0)
+        {
+            Serial.printf("Update Boot Menu Error: %s\n", duk_safe_to_string(ctx, -1));
+        }
+        duk_pop(ctx);
 
-            loopTime = 0;
+        // copy screen buffer texture to screen
+        displayPresent(drawingBuffers[screenBufferId]);
+#ifdef BITSYBOX_HOST
+        hostFrameEnd();
+#endif
 
-            duk_peval_string(ctx, "__bitsybox_is_boot_finished__");
-            isBootFinished = duk_get_boolean(ctx, -1);
-            duk_pop(ctx);
-        }
+        duk_peval_string(ctx, "__bitsybox_is_boot_finished__");
+        isBootFinished = duk_get_boolean(ctx, -1);
+        duk_pop(ctx);
     }
 
     if (isBootFinished)
@@ -613,23 +1800,12 @@ void bootMenu()
 	}
 	duk_pop(ctx);
 
-    duk_destroy_heap(ctx);
+    vmHeapDestroy(ctx);
 }
 
-void gameLoop()
+duk_context *gameStart()
 {
-    duk_context *ctx = duk_create_heap(NULL, NULL, NULL, NULL, fatalError);
-
-    initBitsySystem(ctx);
-
-    // Timing variables
-    int prevTime = millis();
-    int deltaTime = 0;
-    int loopTime = 0;
-    int loopTimeMax = 16;
-    int isGameOver = 0;
-
-    loadEngine(ctx);
+    duk_context *ctx = vmHeapCreate();
 
     shouldContinue = shouldContinue && loadFile(ctx, gameFilePath, "__bitsybox_game_data__");
 
@@ -648,50 +1824,95 @@ void gameLoop()
 		duk_pop(ctx);
 	}
 
-    while (shouldContinue && !isGameOver)
-    {
-        deltaTime = millis() - prevTime;
-        prevTime = millis();
-        loopTime += deltaTime;
+    Serial.printf("VM heap after game load: %lu bytes\n", (unsigned long)vmHeapUsed(ctx));
 
-        // Update input TODO: implement
+    return ctx;
+}
 
-        if (loopTime >= loopTimeMax && shouldContinue)
-        {
-            Color bg = systemPalette[0];
-            tft.fillScreen(tft.color565(bg.r, bg.g, bg.b)); // Clear screen with background color
+void gameUpdate(duk_context *ctx)
+{
+    profileFrameBegin();
 
-            // main loop
-			if (duk_peval_string(ctx, "__bitsybox_on_update__();") != 0) {
-				Serial.printf("Update Bitsy Error: %s\n", duk_safe_to_string(ctx, -1));
-			}
-			duk_pop(ctx);
+    // main loop
+    profileBegin(PROFILE_UPDATE);
+	if (duk_peval_string(ctx, "__bitsybox_on_update__();") != 0) {
+		Serial.printf("Update Bitsy Error: %s\n", duk_safe_to_string(ctx, -1));
+	}
+	duk_pop(ctx);
+    profileEnd(PROFILE_UPDATE);
+
+    // copy screen buffer texture to screen: the only panel transfer in a frame
+    profileBegin(PROFILE_PRESENT);
+    displayPresent(drawingBuffers[screenBufferId]);
+    profileEnd(PROFILE_PRESENT);
+    profileCount(PROFILE_CELLS_PUSHED, displayCellsPushed());
+#ifdef BITSYBOX_HOST
+    // the frame limit quits inside hostFrameEnd(), let the panel catch up first
+    if (hostOptions()->frameLimit > 0 && hostFrameCount() + 1 >= hostOptions()->frameLimit)
+    {
+        displayFlush();
+    }
+    hostFrameEnd();
+#endif
+}
 
-            // copy screen buffer texture to screen
-            drawingBuffers[0]->pushSprite(0, 0);
+int gameIsOver(duk_context *ctx)
+{
+    profileBegin(PROFILE_PROBE);
 
-            loopTime = 0;
-        }
+    // kind of hacky way to trigger restart
+	if (duk_peval_string(ctx, "if (bitsyGetButton(5)) { reset_cur_game(); }") != 0) {
+		Serial.printf("Test Restart Game Error: %s\n", duk_safe_to_string(ctx, -1));
+	}
+	duk_pop(ctx);
 
-        // kind of hacky way to trigger restart
-		if (duk_peval_string(ctx, "if (bitsyGetButton(5)) { reset_cur_game(); }") != 0) {
-			Serial.printf("Test Restart Game Error: %s\n", duk_safe_to_string(ctx, -1));
-		}
-		duk_pop(ctx);
+    if (duk_peval_string(ctx, "__bitsybox_is_game_over__") != 0) {
+		Serial.printf("Test Game Over Error: %s\n", duk_safe_to_string(ctx, -1));
+	}
+	int isGameOver = duk_get_boolean(ctx, -1);
+	duk_pop(ctx);
 
-        if (duk_peval_string(ctx, "__bitsybox_is_game_over__") != 0) {
-			Serial.printf("Test Game Over Error: %s\n", duk_safe_to_string(ctx, -1));
-		}
-		isGameOver = duk_get_boolean(ctx, -1);
-		duk_pop(ctx);
-    }
+    profileEnd(PROFILE_PROBE);
 
+    return isGameOver;
+}
+
+void gameEnd(duk_context *ctx)
+{
     if (duk_peval_string(ctx, "__bitsybox_on_quit__();") != 0) {
 		Serial.printf("Quit Bitsy Error: %s\n", duk_safe_to_string(ctx, -1));
 	}
 	duk_pop(ctx);
 
-    duk_destroy_heap(ctx);
+    vmHeapDestroy(ctx);
+
+    Serial.printf("Heap used after game exit: %lu bytes\n", (unsigned long)heapUsed());
+}
+
+void gameLoop()
+{
+    duk_context *ctx = gameStart();
+
+    FramePacer pacer;
+    pacerStart(&pacer);
+    int isGameOver = 0;
+
+    while (shouldContinue && !isGameOver)
+    {
+        // Update input TODO: implement
+
+        // sleeps until the frame is due; the probes run once per frame along with it
+        int skipped = pacerWait(&pacer);
+
+        gameUpdate(ctx);
+        profileCount(PROFILE_FRAMES_SKIPPED, skipped);
+
+        isGameOver = gameIsOver(ctx);
+
+        profilePollSerial();
+    }
+
+    gameEnd(ctx);
 }
 
 void setup()
@@ -700,6 +1921,13 @@ void setup()
     Serial.println("~*~*~ bitsybox ~*~*~");
     Serial.println("[duktape version 2.6.0]");
 
+    // before anything else takes a bite out of the heap
+#ifdef BITSYBOX_HOST
+    poolInit(hostOptions()->arenaSize > 0 ? hostOptions()->arenaSize : VM_ARENA_SIZE, hostOptions()->pool || VM_POOL);
+#else
+    poolInit(VM_ARENA_SIZE, VM_POOL);
+#endif
+
     // Initialize LittleFS
     if (!LittleFS.begin())
     {
@@ -708,19 +1936,26 @@ void setup()
     }
 
     // Initialize system palette
-    systemPalette[0] = (Color){255, 0, 0}; // Red
-    systemPalette[1] = (Color){0, 255, 0}; // Green
-    systemPalette[2] = (Color){0, 0, 255}; // Blue
+    setPaletteColor(0, 255, 0, 0); // Red
+    setPaletteColor(1, 0, 255, 0); // Green
+    setPaletteColor(2, 0, 0, 255); // Blue
 
     // Initialize TFT display
     tft.init();
     tft.setRotation(0);
     tft.fillScreen(TFT_BLACK);
+#ifdef BITSYBOX_HOST
+    displayInit(hostOptions()->displayTask);
+#else
+    displayInit(DISPLAY_TASK_ENABLED);
+#endif
 
-    // Set up initial drawing buffers
+    // Set up initial drawing buffers (8-bit palette indices, see display.h)
     drawingBuffers[0] = new TFT_eSprite(&tft);
+    drawingBuffers[0]->setColorDepth(8);
     drawingBuffers[0]->createSprite(screenSize, screenSize);
     drawingBuffers[1] = new TFT_eSprite(&tft);
+    drawingBuffers[1]->setColorDepth(8);
     drawingBuffers[1]->createSprite(textboxWidth, textboxHeight);
 }
 
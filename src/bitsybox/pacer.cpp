@@ -0,0 +1,27 @@
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include "pacer.h"
+
+void pacerStart(FramePacer *pacer)
+{
+    pacer->lastWake = xTaskGetTickCount();
+}
+
+int pacerWait(FramePacer *pacer)
+{
+    TickType_t period = pdMS_TO_TICKS(FRAME_PERIOD_MS);
+    TickType_t behind = xTaskGetTickCount() - pacer->lastWake;
+    int dropped = 0;
+
+    if (behind > period * FRAME_CATCH_UP_MAX)
+    {
+        // the frame due now still runs, only the ones before it are dropped
+        dropped = (int)(behind / period) - 1;
+        pacer->lastWake += period * dropped;
+    }
+
+    vTaskDelayUntil(&pacer->lastWake, period);
+
+    return dropped;
+}
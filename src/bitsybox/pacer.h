@@ -0,0 +1,31 @@
+#ifndef PACER_H
+#define PACER_H
+
+#include <freertos/FreeRTOS.h>
+
+/*
+ * Fixed timestep frame scheduler for the boot menu and game loops. Frames are due on
+ * a grid of FRAME_PERIOD_MS, and between them the loop task sleeps in
+ * vTaskDelayUntil() (clock_nanosleep on the host) instead of spinning on millis(),
+ * so the core is free for the idle task and the display task.
+ *
+ * A frame that runs long makes the next one due straight away, which keeps later
+ * frames on the grid. A loop more than FRAME_CATCH_UP_MAX frames behind (a long GC,
+ * a game load) drops the missed frames and only runs the latest one, rather than a
+ * burst of back to back updates.
+ */
+
+#define FRAME_PERIOD_MS 16
+#define FRAME_CATCH_UP_MAX 4
+
+typedef struct FramePacer
+{
+    TickType_t lastWake; // when the last frame was due
+} FramePacer;
+
+void pacerStart(FramePacer *pacer);
+
+// sleep until the next frame is due, returns the number of frames dropped
+int pacerWait(FramePacer *pacer);
+
+#endif
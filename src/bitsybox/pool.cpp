@@ -0,0 +1,882 @@
+#include <Arduino.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "pool.h"
+#include "profiler.h"
+
+/* CLASSES */
+// Capacities are the most blocks each class held at once over the forest replay, the
+// boot menu and mossland, plus about 10%: the working set of a whole game. A region
+// that size is only for the host; VM_POOL_SIZE scales every class down to a budget and
+// the rest of the game goes to malloc, behind a header.
+typedef struct PoolClassConfig
+{
+    uint16_t blockSize; // multiple of 8, so every slot keeps Duktape's alignment
+    uint16_t capacity;
+} PoolClassConfig;
+
+#if UINTPTR_MAX > 0xffffffffUL
+// 64-bit host, from the dump's "high" column: about 60% of Duktape's allocations are
+// 33-64 bytes and another 12% 97-128; under 3% are above 256 and those live the
+// shortest (value stack and string table resizes, compiler buffers). About 1.7 MB.
+static const PoolClassConfig classConfigs[POOL_CLASS_COUNT] = {
+    {16, 16},    // short strings (high 5)
+    {24, 16},    // (high 1)
+    {32, 3800},  // strings, property-less objects (high 3425)
+    {48, 2700},  // objects, small arrays (high 2443)
+    {64, 9900},  // functions, property tables (high 8984)
+    {96, 2000},  // (high 1819)
+    {128, 5100}, // (high 4641)
+};
+#define POOL_BLOCK_MAX 128 // largest class
+#else
+// 32-bit (ESP32): packed 8-byte values and 4-byte pointers shrink every object, and
+// not evenly (an hobject is 40 bytes instead of 56, an hcompfunc 64 instead of 104).
+// Measured by replaying on the host with every Duktape allocation translated to its
+// size in a -m32 build of duktape.c. About 1.3 MB; a game peaks at 1.6-2.1 MB in all.
+static const PoolClassConfig classConfigs[POOL_CLASS_COUNT] = {
+    {24, 8000},  // short strings (high 7245, with the 16s)
+    {32, 2600},  // strings, buffers (high 2364)
+    {40, 10000}, // objects (high 9049)
+    {48, 5100},  // functions, arrays, small property tables (high 4628)
+    {64, 11200}, // compiled functions, property tables (high 10196)
+    {80, 8100},  // property tables (high 7341)
+    {136, 1350}, // function data (high 1221)
+};
+#define POOL_BLOCK_MAX 136
+#endif
+
+// multiplies every capacity, e.g. -DPOOL_CAPACITY_SCALE=4 to measure the high water of a bigger game
+#ifndef POOL_CAPACITY_SCALE
+#define POOL_CAPACITY_SCALE 1
+#endif
+
+#define POOL_GRAIN 8
+
+// class for each size in POOL_GRAIN steps, filled in by poolInit()
+static int8_t sizeClasses[POOL_BLOCK_MAX / POOL_GRAIN + 1];
+
+/* REGION */
+typedef struct PoolClass
+{
+    uint8_t *start;    // fixed slots in the region (without an arena)
+    uint32_t bumpNext; // slots past this were never handed out
+    uint8_t *pageNext; // free space on the class's current arena page
+    uint8_t *pageEnd;
+    void *freeList;    // released slots, linked through their first word
+} PoolClass;
+
+static uint8_t *region = NULL; // NULL without the pool (or an arena): straight to malloc
+static uint8_t *regionEnd = NULL;
+static PoolClass classes[POOL_CLASS_COUNT];
+
+static PoolStats stats;
+
+// blocks above the classes carry their size, since free doesn't pass it
+typedef union BlockHeader
+{
+    struct
+    {
+        uint32_t size;
+        uint32_t capacity; // arena only: bytes after the header (a multiple of POOL_GRAIN), ARENA_BLOCK_ flags
+    };
+    double align;
+} BlockHeader;
+
+/* ARENA */
+// The arena replaces both the region and malloc. Small classes take ARENA_PAGE_SIZE
+// pages from its bottom as they fill, bigger blocks are cut to size (in POOL_GRAIN
+// steps) from its top down, so the two never interleave. A freed big block merges with
+// the free blocks either side (boundary tags: a free block ends with its capacity and
+// the block above it has ARENA_BLOCK_PREV_FREE set) and goes into a bin by size, or
+// gives its space back if it is the lowest. Class pages go back at poolRewind().
+#define ARENA_PAGE_SHIFT 10
+#define ARENA_PAGE_SIZE (1 << ARENA_PAGE_SHIFT)
+#define ARENA_BLOCK_FREE 1
+#define ARENA_BLOCK_PREV_FREE 2
+#define ARENA_BLOCK_FLAGS (POOL_GRAIN - 1)
+#define ARENA_BLOCK_MIN 24   // a free block holds its two bin links and its capacity
+#define ARENA_BIN_EXACT 128  // one bin per POOL_GRAIN below 1 KB, then one per power of two
+#define ARENA_BIN_COUNT (ARENA_BIN_EXACT + 22)
+
+typedef struct FreeLinks
+{
+    union BlockHeader *next;
+    union BlockHeader *previous;
+} FreeLinks;
+
+static uint8_t *arena = NULL;
+static uint8_t *pageTop = NULL;     // class pages below
+static uint8_t *largeBottom = NULL; // big blocks from here up
+static uint8_t *arenaEnd = NULL;
+static uint8_t *pageClasses = NULL; // class of the slots on each page
+static BlockHeader *bins[ARENA_BIN_COUNT];
+
+// once the arena is full, blocks come from malloc, on a list so poolRewind() can free them
+typedef struct OverflowBlock
+{
+    struct OverflowBlock *next;
+    struct OverflowBlock *previous;
+    BlockHeader header;
+} OverflowBlock;
+
+static OverflowBlock *overflowBlocks = NULL;
+
+static bool isInArena(const void *ptr)
+{
+    return (const uint8_t *)ptr >= arena && (const uint8_t *)ptr < arenaEnd;
+}
+
+static OverflowBlock *overflowBlockOf(BlockHeader *header)
+{
+    return (OverflowBlock *)((uint8_t *)header - offsetof(OverflowBlock, header));
+}
+
+static void linkOverflowBlock(OverflowBlock *block)
+{
+    block->next = overflowBlocks;
+    block->previous = NULL;
+    if (overflowBlocks != NULL)
+    {
+        overflowBlocks->previous = block;
+    }
+    overflowBlocks = block;
+}
+
+static void unlinkOverflowBlock(OverflowBlock *block)
+{
+    if (block->previous != NULL)
+    {
+        block->previous->next = block->next;
+    }
+    else
+    {
+        overflowBlocks = block->next;
+    }
+    if (block->next != NULL)
+    {
+        block->next->previous = block->previous;
+    }
+}
+
+static BlockHeader *takeOverflowBlock(size_t size)
+{
+    OverflowBlock *block = (OverflowBlock *)malloc(sizeof(OverflowBlock) + size);
+    if (block == NULL)
+    {
+        return NULL;
+    }
+
+    linkOverflowBlock(block);
+    stats.arenaOverflow++;
+    return &block->header;
+}
+
+static void freeOverflowBlock(BlockHeader *header)
+{
+    OverflowBlock *block = overflowBlockOf(header);
+    unlinkOverflowBlock(block);
+    free(block);
+    stats.arenaOverflow--;
+}
+
+static bool initArena(size_t arenaSize)
+{
+    arena = (uint8_t *)malloc(arenaSize);
+    pageClasses = (uint8_t *)malloc((arenaSize >> ARENA_PAGE_SHIFT) + 1);
+    if (arena == NULL || pageClasses == NULL)
+    {
+        free(arena);
+        free(pageClasses);
+        arena = NULL;
+        pageClasses = NULL;
+        return false;
+    }
+
+    pageTop = arena;
+    arenaEnd = arena + (arenaSize & ~(size_t)(POOL_GRAIN - 1));
+    largeBottom = arenaEnd;
+    stats.arenaSize = arenaSize;
+    return true;
+}
+
+static void updateArenaUsed()
+{
+    stats.arenaUsed = (pageTop - arena) + (arenaEnd - largeBottom);
+    if (stats.arenaUsed > stats.arenaHighWater)
+    {
+        stats.arenaHighWater = stats.arenaUsed;
+    }
+}
+
+static bool takePage(int i)
+{
+    if ((size_t)(largeBottom - pageTop) < ARENA_PAGE_SIZE)
+    {
+        return false;
+    }
+
+    uint8_t *page = pageTop;
+    pageTop += ARENA_PAGE_SIZE;
+    updateArenaUsed();
+
+    pageClasses[(page - arena) >> ARENA_PAGE_SHIFT] = i;
+    classes[i].pageNext = page;
+    classes[i].pageEnd = page + ARENA_PAGE_SIZE - (ARENA_PAGE_SIZE % stats.classes[i].blockSize);
+    stats.classes[i].capacity += ARENA_PAGE_SIZE / stats.classes[i].blockSize;
+    return true;
+}
+
+static size_t blockCapacity(const BlockHeader *header)
+{
+    return header->capacity & ~ARENA_BLOCK_FLAGS;
+}
+
+static uint8_t *blockEnd(BlockHeader *header)
+{
+    return (uint8_t *)(header + 1) + blockCapacity(header);
+}
+
+static FreeLinks *freeLinks(BlockHeader *header)
+{
+    return (FreeLinks *)(header + 1);
+}
+
+// the block above, NULL for the last one
+static BlockHeader *nextBlock(BlockHeader *header)
+{
+    uint8_t *end = blockEnd(header);
+    return end < arenaEnd ? (BlockHeader *)end : NULL;
+}
+
+// only valid with ARENA_BLOCK_PREV_FREE set
+static BlockHeader *previousFreeBlock(BlockHeader *header)
+{
+    uint32_t capacity = ((uint32_t *)header)[-1];
+    return (BlockHeader *)((uint8_t *)header - capacity) - 1;
+}
+
+static int binOf(size_t capacity)
+{
+    if (capacity < ARENA_BIN_EXACT * POOL_GRAIN)
+    {
+        return capacity / POOL_GRAIN;
+    }
+
+    int bin = ARENA_BIN_EXACT;
+    for (size_t rest = capacity / (ARENA_BIN_EXACT * POOL_GRAIN * 2); rest > 0 && bin < ARENA_BIN_COUNT - 1; rest >>= 1)
+    {
+        bin++;
+    }
+    return bin;
+}
+
+// a free block's neighbours are never free: they would have merged
+static void binInsert(BlockHeader *header)
+{
+    size_t capacity = blockCapacity(header);
+    BlockHeader **bin = &bins[binOf(capacity)];
+
+    freeLinks(header)->next = *bin;
+    freeLinks(header)->previous = NULL;
+    if (*bin != NULL)
+    {
+        freeLinks(*bin)->previous = header;
+    }
+    *bin = header;
+
+    header->capacity = capacity | ARENA_BLOCK_FREE;
+    ((uint32_t *)blockEnd(header))[-1] = capacity;
+
+    BlockHeader *next = nextBlock(header);
+    if (next != NULL)
+    {
+        next->capacity |= ARENA_BLOCK_PREV_FREE;
+    }
+}
+
+static void binRemove(BlockHeader *header)
+{
+    FreeLinks *links = freeLinks(header);
+    if (links->previous != NULL)
+    {
+        freeLinks(links->previous)->next = links->next;
+    }
+    else
+    {
+        bins[binOf(blockCapacity(header))] = links->next;
+    }
+    if (links->next != NULL)
+    {
+        freeLinks(links->next)->previous = links->previous;
+    }
+
+    header->capacity &= ~ARENA_BLOCK_FREE;
+
+    BlockHeader *next = nextBlock(header);
+    if (next != NULL)
+    {
+        next->capacity &= ~ARENA_BLOCK_PREV_FREE;
+    }
+}
+
+static void releaseLargeBlock(BlockHeader *header)
+{
+    size_t capacity = blockCapacity(header);
+
+    BlockHeader *next = nextBlock(header);
+    if (next != NULL && (next->capacity & ARENA_BLOCK_FREE))
+    {
+        binRemove(next);
+        capacity += sizeof(BlockHeader) + blockCapacity(next);
+    }
+
+    if (header->capacity & ARENA_BLOCK_PREV_FREE)
+    {
+        BlockHeader *previous = previousFreeBlock(header);
+        binRemove(previous);
+        capacity += sizeof(BlockHeader) + blockCapacity(previous);
+        header = previous;
+    }
+
+    header->capacity = capacity;
+
+    if ((uint8_t *)header == largeBottom)
+    {
+        largeBottom = blockEnd(header);
+        updateArenaUsed();
+        return;
+    }
+
+    binInsert(header);
+}
+
+// free the end of a block in use past capacity bytes, if there is enough of it
+static void trimLargeBlock(BlockHeader *header, size_t capacity)
+{
+    size_t spare = blockCapacity(header) - capacity;
+    if (spare < sizeof(BlockHeader) + ARENA_BLOCK_MIN)
+    {
+        return;
+    }
+
+    header->capacity = capacity | (header->capacity & ARENA_BLOCK_FLAGS);
+
+    BlockHeader *rest = (BlockHeader *)blockEnd(header);
+    rest->capacity = spare - sizeof(BlockHeader);
+    releaseLargeBlock(rest);
+}
+
+// the first fit from the smallest bin that may hold it, or else off the free space
+static BlockHeader *takeLargeBlock(size_t capacity)
+{
+    for (int bin = binOf(capacity); bin < ARENA_BIN_COUNT; bin++)
+    {
+        for (BlockHeader *header = bins[bin]; header != NULL; header = freeLinks(header)->next)
+        {
+            if (blockCapacity(header) >= capacity)
+            {
+                binRemove(header);
+                trimLargeBlock(header, capacity);
+                return header;
+            }
+        }
+    }
+
+    if ((size_t)(largeBottom - pageTop) < sizeof(BlockHeader) + capacity)
+    {
+        return NULL;
+    }
+
+    largeBottom -= sizeof(BlockHeader) + capacity;
+    updateArenaUsed();
+
+    BlockHeader *header = (BlockHeader *)largeBottom;
+    header->capacity = capacity;
+    return header;
+}
+
+static size_t largeCapacity(size_t size)
+{
+    size_t capacity = (size + POOL_GRAIN - 1) & ~(size_t)(POOL_GRAIN - 1);
+    return capacity > ARENA_BLOCK_MIN ? capacity : ARENA_BLOCK_MIN;
+}
+
+/* INIT */
+void poolInit(size_t arenaSize, bool isPooled)
+{
+    if (region != NULL || arena != NULL)
+    {
+        return;
+    }
+
+    if (arenaSize > 0 && !initArena(arenaSize))
+    {
+        Serial.printf("VM arena of %lu bytes allocation failed, using the pool\n", (unsigned long)arenaSize);
+    }
+
+    uint32_t capacities[POOL_CLASS_COUNT];
+    size_t regionSize = 0;
+    for (int i = 0; i < POOL_CLASS_COUNT; i++)
+    {
+        capacities[i] = (uint32_t)classConfigs[i].capacity * POOL_CAPACITY_SCALE;
+        regionSize += (size_t)classConfigs[i].blockSize * capacities[i];
+    }
+
+    // the same share of every class's high water
+    if (VM_POOL_SIZE > 0 && regionSize > VM_POOL_SIZE)
+    {
+        size_t scaledSize = 0;
+        for (int i = 0; i < POOL_CLASS_COUNT; i++)
+        {
+            capacities[i] = (uint32_t)(((uint64_t)capacities[i] * VM_POOL_SIZE) / regionSize);
+            scaledSize += (size_t)classConfigs[i].blockSize * capacities[i];
+        }
+        regionSize = scaledSize;
+    }
+
+    if (arena == NULL && isPooled)
+    {
+        region = (uint8_t *)malloc(regionSize);
+        if (region == NULL)
+        {
+            Serial.printf("VM pool of %lu bytes allocation failed, using malloc\n", (unsigned long)regionSize);
+        }
+    }
+
+    uint8_t *next = region;
+    int sizeClass = 0;
+    for (int i = 0; i < POOL_CLASS_COUNT; i++)
+    {
+        classes[i].start = next;
+        classes[i].bumpNext = 0;
+        classes[i].pageNext = NULL;
+        classes[i].pageEnd = NULL;
+        classes[i].freeList = NULL;
+
+        stats.classes[i].blockSize = classConfigs[i].blockSize;
+        stats.classes[i].capacity = region != NULL ? capacities[i] : 0;
+
+        if (region != NULL)
+        {
+            next += (size_t)classConfigs[i].blockSize * stats.classes[i].capacity;
+        }
+    }
+    regionEnd = next;
+
+    for (int grain = 0; grain <= POOL_BLOCK_MAX / POOL_GRAIN; grain++)
+    {
+        while (classConfigs[sizeClass].blockSize < grain * POOL_GRAIN)
+        {
+            sizeClass++;
+        }
+        sizeClasses[grain] = sizeClass;
+    }
+}
+
+bool poolIsEnabled()
+{
+    return region != NULL || arena != NULL;
+}
+
+bool poolIsArena()
+{
+    return arena != NULL;
+}
+
+// -1 for blocks above the classes
+static int classOf(void *ptr)
+{
+    uint8_t *p = (uint8_t *)ptr;
+
+    if (arena != NULL)
+    {
+        return isInArena(p) && p < largeBottom ? pageClasses[(p - arena) >> ARENA_PAGE_SHIFT] : -1;
+    }
+
+    if (p < region || p >= regionEnd)
+    {
+        return -1;
+    }
+
+    int i = POOL_CLASS_COUNT - 1;
+    while (p < classes[i].start)
+    {
+        i--;
+    }
+    return i;
+}
+
+static void addInUse(int32_t bytes)
+{
+    stats.bytesInUse += bytes;
+    if (stats.bytesInUse > stats.highWater)
+    {
+        stats.highWater = stats.bytesInUse;
+    }
+}
+
+/* BLOCKS */
+static void *takeSlot(int i)
+{
+    PoolClass *poolClass = &classes[i];
+    PoolClassStats *classStats = &stats.classes[i];
+    void *slot;
+
+    if (poolClass->freeList != NULL)
+    {
+        slot = poolClass->freeList;
+        poolClass->freeList = *(void **)slot;
+    }
+    else if (arena != NULL)
+    {
+        if (poolClass->pageNext == poolClass->pageEnd && !takePage(i))
+        {
+            return NULL; // the arena is full, the large lists may still have room
+        }
+
+        slot = poolClass->pageNext;
+        poolClass->pageNext += classStats->blockSize;
+    }
+    else if (poolClass->bumpNext < classStats->capacity)
+    {
+        slot = poolClass->start + (size_t)poolClass->bumpNext * classStats->blockSize;
+        poolClass->bumpNext++;
+    }
+    else
+    {
+        classStats->misses++;
+        return NULL;
+    }
+
+    classStats->used++;
+    if (classStats->used > classStats->highWater)
+    {
+        classStats->highWater = classStats->used;
+    }
+    addInUse(classStats->blockSize);
+
+    return slot;
+}
+
+static void releaseSlot(int i, void *slot)
+{
+    *(void **)slot = classes[i].freeList;
+    classes[i].freeList = slot;
+
+    stats.classes[i].used--;
+    stats.bytesInUse -= stats.classes[i].blockSize;
+}
+
+static void *largeBlock(size_t size)
+{
+    BlockHeader *header;
+
+    if (arena != NULL)
+    {
+        header = takeLargeBlock(largeCapacity(size));
+        if (header == NULL)
+        {
+            header = takeOverflowBlock(size);
+        }
+    }
+    else
+    {
+        header = (BlockHeader *)malloc(sizeof(BlockHeader) + size);
+    }
+
+    if (header == NULL)
+    {
+        stats.failed++;
+        return NULL;
+    }
+
+    header->size = size;
+    stats.largeBlocks++;
+    stats.largeBytes += size;
+    addInUse(size);
+
+    return header + 1;
+}
+
+static void freeLargeBlock(void *ptr)
+{
+    BlockHeader *header = (BlockHeader *)ptr - 1;
+
+    stats.largeBlocks--;
+    stats.largeBytes -= header->size;
+    stats.bytesInUse -= header->size;
+
+    if (arena != NULL && isInArena(header))
+    {
+        releaseLargeBlock(header);
+    }
+    else if (arena != NULL)
+    {
+        freeOverflowBlock(header);
+    }
+    else
+    {
+        free(header);
+    }
+}
+
+// a large block keeps its place if the new size still fits it, or if the block above
+// it is free and big enough to take the difference
+static BlockHeader *resizeLargeBlock(BlockHeader *header, size_t size)
+{
+    if (arena == NULL)
+    {
+        return (BlockHeader *)realloc(header, sizeof(BlockHeader) + size);
+    }
+
+    if (!isInArena(header))
+    {
+        OverflowBlock *block = overflowBlockOf(header);
+        unlinkOverflowBlock(block);
+
+        OverflowBlock *resized = (OverflowBlock *)realloc(block, sizeof(OverflowBlock) + size);
+        linkOverflowBlock(resized != NULL ? resized : block);
+        return resized != NULL ? &resized->header : NULL;
+    }
+
+    size_t capacity = largeCapacity(size);
+    if (capacity <= blockCapacity(header))
+    {
+        return header;
+    }
+
+    BlockHeader *next = nextBlock(header);
+    if (next == NULL || !(next->capacity & ARENA_BLOCK_FREE) ||
+        blockCapacity(header) + sizeof(BlockHeader) + blockCapacity(next) < capacity)
+    {
+        return NULL;
+    }
+
+    binRemove(next);
+    header->capacity += sizeof(BlockHeader) + blockCapacity(next);
+    trimLargeBlock(header, capacity);
+    return header;
+}
+
+static void *allocate(size_t size)
+{
+    if (size <= POOL_BLOCK_MAX)
+    {
+        void *slot = takeSlot(sizeClasses[(size + POOL_GRAIN - 1) / POOL_GRAIN]);
+        if (slot != NULL)
+        {
+            return slot;
+        }
+    }
+
+    return largeBlock(size);
+}
+
+/* DUKTAPE */
+void *poolAlloc(void *udata, duk_size_t size)
+{
+    if (size == 0)
+    {
+        return NULL;
+    }
+
+    profileCount(PROFILE_ALLOCS, 1);
+    profileCount(PROFILE_ALLOC_BYTES, size);
+
+    if (!poolIsEnabled())
+    {
+        return malloc(size);
+    }
+
+    return allocate(size);
+}
+
+void *poolRealloc(void *udata, void *ptr, duk_size_t size)
+{
+    if (ptr == NULL)
+    {
+        return poolAlloc(udata, size);
+    }
+
+    if (size == 0)
+    {
+        poolFree(udata, ptr);
+        return NULL;
+    }
+
+    profileCount(PROFILE_ALLOCS, 1);
+    profileCount(PROFILE_ALLOC_BYTES, size);
+
+    if (!poolIsEnabled())
+    {
+        return realloc(ptr, size);
+    }
+
+    int i = classOf(ptr);
+    if (i >= 0)
+    {
+        uint32_t blockSize = stats.classes[i].blockSize;
+        if (size <= blockSize)
+        {
+            return ptr; // shrinking, or growing within the slot
+        }
+
+        void *moved = allocate(size);
+        if (moved == NULL)
+        {
+            return NULL; // the old block stays valid, as Duktape expects
+        }
+
+        memcpy(moved, ptr, blockSize);
+        releaseSlot(i, ptr);
+        return moved;
+    }
+
+    // large blocks stay large: the ones resized are the big buffers
+    BlockHeader *header = (BlockHeader *)ptr - 1;
+    size_t oldSize = header->size;
+
+    BlockHeader *resized = resizeLargeBlock(header, size);
+    if (resized == NULL && arena != NULL)
+    {
+        void *moved = largeBlock(size);
+        if (moved != NULL)
+        {
+            memcpy(moved, ptr, oldSize < size ? oldSize : size);
+            freeLargeBlock(ptr);
+        }
+        return moved;
+    }
+
+    if (resized == NULL)
+    {
+        stats.failed++;
+        return NULL;
+    }
+
+    resized->size = size;
+    stats.largeBytes += size - oldSize;
+    stats.bytesInUse -= oldSize;
+    addInUse(size);
+
+    return resized + 1;
+}
+
+void poolFree(void *udata, void *ptr)
+{
+    if (ptr == NULL)
+    {
+        return;
+    }
+
+    if (!poolIsEnabled())
+    {
+        free(ptr);
+        return;
+    }
+
+    int i = classOf(ptr);
+    if (i >= 0)
+    {
+        releaseSlot(i, ptr);
+    }
+    else
+    {
+        freeLargeBlock(ptr);
+    }
+}
+
+void poolRewind()
+{
+    if (arena == NULL)
+    {
+        return;
+    }
+
+    pageTop = arena;
+    largeBottom = arenaEnd;
+    updateArenaUsed();
+    memset(bins, 0, sizeof(bins));
+
+    while (overflowBlocks != NULL)
+    {
+        OverflowBlock *block = overflowBlocks;
+        overflowBlocks = block->next;
+        free(block);
+    }
+    stats.arenaOverflow = 0;
+
+    for (int i = 0; i < POOL_CLASS_COUNT; i++)
+    {
+        classes[i].pageNext = NULL;
+        classes[i].pageEnd = NULL;
+        classes[i].freeList = NULL;
+        stats.classes[i].capacity = 0;
+        stats.classes[i].used = 0;
+    }
+
+    stats.bytesInUse = 0;
+    stats.largeBlocks = 0;
+    stats.largeBytes = 0;
+}
+
+/* STATS */
+const PoolStats *poolStats()
+{
+    return &stats;
+}
+
+void poolResetHighWater()
+{
+    stats.highWater = stats.bytesInUse;
+    stats.arenaHighWater = stats.arenaUsed;
+    for (int i = 0; i < POOL_CLASS_COUNT; i++)
+    {
+        stats.classes[i].highWater = stats.classes[i].used;
+    }
+}
+
+void poolDump(void (*writeLine)(const char *line))
+{
+    char line[96];
+
+    if (!poolIsEnabled())
+    {
+        writeLine("vm pool: off, blocks come from malloc\n");
+        return;
+    }
+
+    snprintf(line, sizeof(line), "vm pool: %lu bytes in use, high water %lu, %lu failed\n",
+             (unsigned long)stats.bytesInUse, (unsigned long)stats.highWater, (unsigned long)stats.failed);
+    writeLine(line);
+
+    if (arena != NULL)
+    {
+        snprintf(line, sizeof(line), "vm arena: %lu of %lu bytes taken, high water %lu, %lu blocks in malloc\n",
+                 (unsigned long)stats.arenaUsed, (unsigned long)stats.arenaSize, (unsigned long)stats.arenaHighWater,
+                 (unsigned long)stats.arenaOverflow);
+        writeLine(line);
+    }
+
+    snprintf(line, sizeof(line), "%-12s %8s %8s %8s %8s\n", "block", "capacity", "used", "high", "misses");
+    writeLine(line);
+
+    for (int i = 0; i < POOL_CLASS_COUNT; i++)
+    {
+        const PoolClassStats *classStats = &stats.classes[i];
+        snprintf(line, sizeof(line), "%-12lu %8lu %8lu %8lu %8lu\n",
+                 (unsigned long)classStats->blockSize,
+                 (unsigned long)classStats->capacity,
+                 (unsigned long)classStats->used,
+                 (unsigned long)classStats->highWater,
+                 (unsigned long)classStats->misses);
+        writeLine(line);
+    }
+
+    snprintf(line, sizeof(line), "%-12s %8s %8lu %8s %8s (%lu bytes)\n", arena != NULL ? "large" : "malloc", "-",
+             (unsigned long)stats.largeBlocks, "-", "-", (unsigned long)stats.largeBytes);
+    writeLine(line);
+}
@@ -0,0 +1,105 @@
+#ifndef POOL_H
+#define POOL_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "duktape/duktape.h"
+
+/*
+ * Allocation functions for the Duktape heaps (boot menu and game). By default they
+ * only count allocations for the profiler and pass them to malloc.
+ *
+ * With VM_POOL set, small blocks (hstrings, hobjects, property tables) come from
+ * fixed-size slots carved out of one region that is reserved once at setup and kept
+ * for the whole session, so the objects in it never fragment the general heap. Blocks
+ * larger than the biggest class, or asked for while their class is full, fall back to
+ * malloc. Class sizes and capacities come from the per-class high water of the replay
+ * benchmark, one table for 64-bit and one for 32-bit builds (see pool.cpp). A whole
+ * game's working set is more than an ESP32 has, so the esp32dev envs reserve
+ * VM_POOL_SIZE: the first objects of a VM, the engine's included, live in the region
+ * and the game's overflow goes to malloc. Send 'p' over Serial for the counters (the
+ * misses column is the overflow), they follow the profile table.
+ *
+ * With VM_ARENA_SIZE set, each VM lives in one contiguous arena reserved at setup
+ * instead: the classes and the big blocks are all cut from it, and tearing a VM down
+ * is a rewind of the arena rather than a free of every object. Once the arena is full
+ * the big blocks go to malloc, on a list the rewind frees too. The system heap then
+ * looks the same after every game, however it was used (the replay prints it).
+ *
+ * Size the arena from the dump's arena high water, run with a big --arena on the host:
+ * the forest replay peaks at 2920752 bytes (2785667 in blocks, the rest is free big
+ * blocks and page tails), 2934032 with the shared VM after mossland; mossland alone
+ * takes 1145544. That is well past the ESP32's DRAM, so esp32dev_arena reserves a
+ * 96 KB arena for the first objects of a VM and the rest of the game overflows to malloc.
+ */
+
+// reserve the size-class region (0: malloc, counted for the profiler only)
+#ifndef VM_POOL
+#define VM_POOL 0
+#endif
+
+// bytes for the region: 0 gives every class its measured high water (about 1.7 MB on
+// the host, 1.3 MB on the ESP32), a smaller size the same share of it to every class
+#ifndef VM_POOL_SIZE
+#define VM_POOL_SIZE 0
+#endif
+
+// bytes reserved for the VM arena (0: VM_POOL decides), used with or without VM_POOL
+#ifndef VM_ARENA_SIZE
+#define VM_ARENA_SIZE 0
+#endif
+
+#define POOL_CLASS_COUNT 7
+
+typedef struct PoolClassStats
+{
+    uint32_t blockSize;
+    uint32_t capacity;  // blocks
+    uint32_t used;      // blocks handed out right now
+    uint32_t highWater; // most blocks ever used at once
+    uint32_t misses;    // allocations that fell back to malloc because the class was full
+                        // (with an arena a class grows a page at a time instead)
+} PoolClassStats;
+
+typedef struct PoolStats
+{
+    uint32_t bytesInUse;  // class blocks (whole slots) plus large blocks (as requested)
+    uint32_t highWater;   // most bytesInUse ever
+    uint32_t largeBlocks; // blocks above the classes (or that missed them) live right now
+    uint32_t largeBytes;
+    uint32_t failed;      // allocations that could not be satisfied at all (Duktape then GCs and retries)
+    uint32_t arenaSize;   // 0 without an arena
+    uint32_t arenaUsed;   // taken off the top of the arena: pages and large blocks, free or not
+    uint32_t arenaHighWater;
+    uint32_t arenaOverflow; // of the large blocks, those in malloc because the arena was full
+    PoolClassStats classes[POOL_CLASS_COUNT];
+} PoolStats;
+
+// reserve an arena of arenaSize bytes, or else the pool region if isPooled; call
+// early, before the heap has been broken up
+void poolInit(size_t arenaSize, bool isPooled);
+
+// false when blocks go straight to malloc: the stats then stay at zero
+bool poolIsEnabled();
+
+bool poolIsArena();
+
+// with an arena, drop every block at once: only once the VM using it is abandoned
+void poolRewind();
+
+const PoolStats *poolStats();
+
+// restart the high water marks from the current use
+void poolResetHighWater();
+
+// write the counters, one line at a time
+void poolDump(void (*writeLine)(const char *line));
+
+// allocation functions for duk_create_heap(). They also feed the profiler's alloc
+// counters, so allocation churn (what drives the mark-and-sweep GC) shows up next to
+// the phase timings.
+void *poolAlloc(void *udata, duk_size_t size);
+void *poolRealloc(void *udata, void *ptr, duk_size_t size);
+void poolFree(void *udata, void *ptr);
+
+#endif
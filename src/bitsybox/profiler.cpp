@@ -0,0 +1,221 @@
+#include <Arduino.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include "profiler.h"
+#include "pool.h"
+
+/* SERIES */
+// one rolling window per phase, the frame total, then one per counter
+enum
+{
+    SERIES_TOTAL = PROFILE_PHASE_COUNT,
+    SERIES_COUNTERS,
+    SERIES_COUNT = SERIES_COUNTERS + PROFILE_COUNTER_COUNT
+};
+
+static const char *seriesNames[SERIES_COUNT] = {
+    "update us",
+    "present us",
+    "probe us",
+    "total us",
+    "allocs",
+    "alloc bytes",
+    "cells pushed",
+    "dma wait us",
+    "queue depth",
+    "dropped",
+    "interval us",
+    "skipped",
+    "tile blits",
+    "gc us",
+    "gc runs",
+};
+
+static uint32_t samples[SERIES_COUNT][PROFILE_WINDOW];
+static uint32_t sampleCount = 0; // frames recorded since the last reset
+static uint32_t sampleNext = 0;
+
+/* CURRENT FRAME */
+static bool isFrameOpen = false;
+static uint32_t frameValues[SERIES_COUNT];
+static unsigned long phaseStart[PROFILE_PHASE_COUNT];
+static unsigned long frameStart = 0;
+static unsigned long gcStart = 0;
+
+static uint32_t minFreeHeap = UINT32_MAX;
+
+static void frameEnd()
+{
+    uint32_t total = 0;
+    for (int phase = 0; phase < PROFILE_PHASE_COUNT; phase++)
+    {
+        total += frameValues[phase];
+    }
+    frameValues[SERIES_TOTAL] = total;
+
+    for (int series = 0; series < SERIES_COUNT; series++)
+    {
+        samples[series][sampleNext] = frameValues[series];
+    }
+
+    sampleNext = (sampleNext + 1) % PROFILE_WINDOW;
+    sampleCount++;
+
+    uint32_t freeHeap = ESP.getFreeHeap();
+    if (freeHeap < minFreeHeap)
+    {
+        minFreeHeap = freeHeap;
+    }
+}
+
+void profileFrameBegin()
+{
+    unsigned long now = micros();
+    bool isFirst = !isFrameOpen;
+
+    if (isFrameOpen)
+    {
+        frameEnd();
+    }
+
+    memset(frameValues, 0, sizeof(frameValues));
+    frameValues[SERIES_COUNTERS + PROFILE_FRAME_INTERVAL_US] = isFirst ? 0 : (uint32_t)(now - frameStart);
+    frameStart = now;
+    isFrameOpen = true;
+}
+
+void profileBegin(ProfilePhase phase)
+{
+    phaseStart[phase] = micros();
+}
+
+void profileEnd(ProfilePhase phase)
+{
+    if (isFrameOpen)
+    {
+        frameValues[phase] += (uint32_t)(micros() - phaseStart[phase]);
+    }
+}
+
+void profileCount(ProfileCounter counter, uint32_t amount)
+{
+    frameValues[SERIES_COUNTERS + counter] += amount;
+}
+
+void profileGcBegin(void)
+{
+    gcStart = micros();
+}
+
+void profileGcEnd(void)
+{
+    profileCount(PROFILE_GC_US, (uint32_t)(micros() - gcStart));
+    profileCount(PROFILE_GC_RUNS, 1);
+}
+
+void profileReset()
+{
+    sampleCount = 0;
+    sampleNext = 0;
+    isFrameOpen = false;
+    minFreeHeap = UINT32_MAX;
+    poolResetHighWater();
+}
+
+void profilePollSerial()
+{
+    while (Serial.available() > 0)
+    {
+        int c = Serial.read();
+
+        if (c == 'p')
+        {
+            profileDump([](const char *line) { Serial.print(line); });
+        }
+        else if (c == 'r')
+        {
+            profileReset();
+            Serial.println("profile reset");
+        }
+    }
+}
+
+void profileDump(void (*writeLine)(const char *line))
+{
+    static uint32_t sorted[PROFILE_WINDOW];
+    char line[96];
+
+    uint32_t count = std::min(sampleCount, (uint32_t)PROFILE_WINDOW);
+
+    snprintf(line, sizeof(line), "profile: last %lu of %lu frames\n", (unsigned long)count, (unsigned long)sampleCount);
+    writeLine(line);
+
+    if (count == 0)
+    {
+        return;
+    }
+
+    snprintf(line, sizeof(line), "%-12s %8s %8s %8s %8s\n", "", "min", "avg", "p99", "max");
+    writeLine(line);
+
+    for (int series = 0; series < SERIES_COUNT; series++)
+    {
+        memcpy(sorted, samples[series], count * sizeof(uint32_t));
+        std::sort(sorted, sorted + count);
+
+        uint64_t sum = 0;
+        for (uint32_t i = 0; i < count; i++)
+        {
+            sum += sorted[i];
+        }
+
+        snprintf(line, sizeof(line), "%-12s %8lu %8lu %8lu %8lu\n",
+                 seriesNames[series],
+                 (unsigned long)sorted[0],
+                 (unsigned long)(sum / count),
+                 (unsigned long)sorted[(count * 99) / 100],
+                 (unsigned long)sorted[count - 1]);
+        writeLine(line);
+    }
+
+    snprintf(line, sizeof(line), "heap free %lu, min free %lu\n", (unsigned long)ESP.getFreeHeap(), (unsigned long)minFreeHeap);
+    writeLine(line);
+
+    poolDump(writeLine);
+}
+
+/* HOST */
+#ifdef BITSYBOX_HOST
+static FILE *dumpFile = NULL;
+
+static void writeDumpLine(const char *line)
+{
+    fputs(line, dumpFile);
+}
+
+static void writeDump()
+{
+    dumpFile = fopen(hostOptions()->profilePath, "w");
+    if (dumpFile == NULL)
+    {
+        fprintf(stderr, "Failed to write profile: %s\n", hostOptions()->profilePath);
+        return;
+    }
+
+    profileDump(writeDumpLine);
+    fclose(dumpFile);
+}
+
+static void dumpAtExit()
+{
+    if (hostOptions()->profilePath != NULL)
+    {
+        writeDump();
+    }
+}
+
+// registered during static initialisation, so the table is written however the program exits
+static int dumpAtExitRegistered = atexit(dumpAtExit);
+#endif
@@ -0,0 +1,65 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <stdint.h>
+
+/*
+ * Per-phase frame profiler. Each frame the time spent in every phase is summed, and
+ * the last PROFILE_WINDOW frames are kept so min/avg/p99/max can be reported. With
+ * update us (JS), present us and dma wait us (SPI) and gc us (Duktape's mark-and-sweep)
+ * side by side, a slow frame shows which of them it was bound by.
+ *
+ * Send 'p' over Serial to dump the table and the VM pool counters ('r' resets them).
+ * On the host build the table is also written to the file given with --profile when
+ * the program exits.
+ */
+
+#define PROFILE_WINDOW 256
+
+typedef enum ProfilePhase
+{
+    PROFILE_UPDATE,  // __bitsybox_on_update__() (JS, including any GC it triggers: see gc us)
+    PROFILE_PRESENT, // screen buffer to panel
+    PROFILE_PROBE,   // restart / game over checks
+    PROFILE_PHASE_COUNT
+} ProfilePhase;
+
+typedef enum ProfileCounter
+{
+    PROFILE_ALLOCS,       // Duktape allocations (see poolAlloc)
+    PROFILE_ALLOC_BYTES,
+    PROFILE_CELLS_PUSHED, // 8x8 screen cells sent to the panel
+    PROFILE_PRESENT_WAIT_US, // part of present spent waiting for the previous DMA transfer
+    PROFILE_QUEUE_DEPTH,     // frames waiting for the display task, this one included
+    PROFILE_FRAMES_DROPPED,  // frames not presented because every slot was busy
+    PROFILE_FRAME_INTERVAL_US, // since the previous frame began (its jitter is the pacing)
+    PROFILE_FRAMES_SKIPPED,    // frames the loop fell too far behind to run (see pacer.h)
+    PROFILE_TILE_BLITS,        // tiles expanded into the screen or the room layer
+    PROFILE_GC_US,             // in Duktape mark-and-sweep, voluntary or not (part of a phase)
+    PROFILE_GC_RUNS,
+    PROFILE_COUNTER_COUNT
+} ProfileCounter;
+
+// starts a new frame, closing the previous one
+void profileFrameBegin();
+
+void profileBegin(ProfilePhase phase);
+void profileEnd(ProfilePhase phase);
+
+// add to a per-frame counter
+void profileCount(ProfileCounter counter, uint32_t amount);
+
+// called by Duktape around every mark-and-sweep pass (see the end of duk_config.h)
+extern "C" void profileGcBegin(void);
+extern "C" void profileGcEnd(void);
+
+// drop all collected samples
+void profileReset();
+
+// handle 'p' (dump) / 'r' (reset) requests on Serial
+void profilePollSerial();
+
+// write the table, one line at a time
+void profileDump(void (*writeLine)(const char *line));
+
+#endif
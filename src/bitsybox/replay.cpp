@@ -0,0 +1,636 @@
+#ifdef BITSYBOX_HOST
+
+/*
+ * Deterministic input-replay benchmark (host build only).
+ *
+ *   program --replay a_night_train_to_the_forest_zone.bitsy --input util/replay/a_night_train_to_the_forest_zone.replay
+ *           [--frames N] [--out frames.txt] [--baseline frames.txt] [--tolerance 0.25] [--seed N]
+ *           [--warm-up other.bitsy] [--reset-check other.bitsy]
+ *
+ * The game is run one frame at a time on the virtual clock (16 ms per frame), with
+ * button state taken from the input script. Each frame writes one line:
+ *
+ *   <frame> <panel hash> <update us> <probe us> <cells pushed>
+ *
+ * With --baseline the run is compared against an earlier output: any hash mismatch, or
+ * a different number of frames, is a visual regression (exit 2); an average frame time
+ * more than --tolerance slower is a timing regression (exit 3).
+ *
+ * --warm-up checks the shared VM's reset contract (see vmReset() in main.cpp): another
+ * game is played for REPLAY_WARM_UP_FRAMES on the same input script first, in the VM
+ * the replayed game then reuses. Its frames must match a cold run's exactly.
+ *
+ * --reset-check runs that check both ways without a baseline: each game is played cold,
+ * then right after the other in one shared VM, all on the same input script. A game
+ * whose frames differ from its cold run is a visual regression (exit 2).
+ *
+ * Input scripts are text, one event per line, '#' starts a comment:
+ *
+ *   <frame> <button>[+<button>...]   hold exactly these buttons from <frame> on
+ *   <frame> -                        release everything
+ *   <frame> end                      stop the replay
+ *
+ * Button names match the isButton* globals: up down left right w a s d r space return
+ * escape lctrl rctrl lalt ralt padup paddown padleft padright pada padb padx pady padstart
+ */
+
+#include <Arduino.h>
+#include <LittleFS.h>
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <vector>
+#include "bitsybox.h"
+#include "display.h"
+
+#define REPLAY_FRAME_TIME 16
+#define REPLAY_WARM_UP_FRAMES 1800
+
+typedef struct ReplayButton
+{
+    const char *name;
+    int *state;
+} ReplayButton;
+
+static ReplayButton replayButtons[] = {
+    {"up", &isButtonUp},
+    {"down", &isButtonDown},
+    {"left", &isButtonLeft},
+    {"right", &isButtonRight},
+    {"w", &isButtonW},
+    {"a", &isButtonA},
+    {"s", &isButtonS},
+    {"d", &isButtonD},
+    {"r", &isButtonR},
+    {"space", &isButtonSpace},
+    {"return", &isButtonReturn},
+    {"escape", &isButtonEscape},
+    {"lctrl", &isButtonLCtrl},
+    {"rctrl", &isButtonRCtrl},
+    {"lalt", &isButtonLAlt},
+    {"ralt", &isButtonRAlt},
+    {"padup", &isButtonPadUp},
+    {"paddown", &isButtonPadDown},
+    {"padleft", &isButtonPadLeft},
+    {"padright", &isButtonPadRight},
+    {"pada", &isButtonPadA},
+    {"padb", &isButtonPadB},
+    {"padx", &isButtonPadX},
+    {"pady", &isButtonPadY},
+    {"padstart", &isButtonPadStart},
+};
+
+static const int replayButtonCount = sizeof(replayButtons) / sizeof(replayButtons[0]);
+
+typedef struct ReplayEvent
+{
+    long frame;
+    uint32_t buttons; // bit per replayButtons entry
+    int isEnd;
+} ReplayEvent;
+
+typedef struct ReplayFrame
+{
+    long frame;
+    uint64_t hash;
+    unsigned long updateMicros;
+    unsigned long probeMicros;
+    int cellsPushed;
+} ReplayFrame;
+
+static const char *argValue(int argc, char **argv, const char *name)
+{
+    for (int i = 1; i < argc - 1; i++)
+    {
+        if (strcmp(argv[i], name) == 0)
+        {
+            return argv[i + 1];
+        }
+    }
+
+    return NULL;
+}
+
+static int findButton(const char *name)
+{
+    for (int i = 0; i < replayButtonCount; i++)
+    {
+        if (strcmp(replayButtons[i].name, name) == 0)
+        {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+static int loadInputScript(const char *path, std::vector<ReplayEvent> &events)
+{
+    FILE *file = fopen(path, "r");
+    if (!file)
+    {
+        fprintf(stderr, "replay: failed to open input script: %s\n", path);
+        return 0;
+    }
+
+    char line[256];
+    int lineNumber = 0;
+
+    while (fgets(line, sizeof(line), file))
+    {
+        lineNumber++;
+
+        char *comment = strchr(line, '#');
+        if (comment)
+        {
+            *comment = '\0';
+        }
+
+        long frame = 0;
+        char buttons[200];
+        int fieldCount = sscanf(line, "%ld %199s", &frame, buttons);
+
+        if (fieldCount <= 0)
+        {
+            continue; // blank line
+        }
+        else if (fieldCount != 2)
+        {
+            fprintf(stderr, "replay: %s:%d: expected '<frame> <buttons>'\n", path, lineNumber);
+            fclose(file);
+            return 0;
+        }
+
+        ReplayEvent event = {frame, 0, 0};
+
+        if (strcmp(buttons, "end") == 0)
+        {
+            event.isEnd = 1;
+        }
+        else if (strcmp(buttons, "-") != 0)
+        {
+            for (char *name = strtok(buttons, "+"); name != NULL; name = strtok(NULL, "+"))
+            {
+                int buttonIndex = findButton(name);
+                if (buttonIndex < 0)
+                {
+                    fprintf(stderr, "replay: %s:%d: unknown button '%s'\n", path, lineNumber, name);
+                    fclose(file);
+                    return 0;
+                }
+
+                event.buttons |= (1u << buttonIndex);
+            }
+        }
+
+        events.push_back(event);
+    }
+
+    fclose(file);
+
+    // stable so later lines for the same frame win
+    std::stable_sort(events.begin(), events.end(), [](const ReplayEvent &a, const ReplayEvent &b) {
+        return a.frame < b.frame;
+    });
+
+    return 1;
+}
+
+static void applyButtons(uint32_t buttons)
+{
+    for (int i = 0; i < replayButtonCount; i++)
+    {
+        *replayButtons[i].state = (buttons >> i) & 1;
+    }
+}
+
+// hash what reached the panel: the drawing buffers hold palette indices, so palette
+// changes only show up after present
+static uint64_t hashPanel()
+{
+    const uint8_t *data = (const uint8_t *)tft.panelBuffer();
+    size_t length = (size_t)tft.width() * tft.height() * sizeof(uint16_t);
+
+    // FNV-1a
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (size_t i = 0; data != NULL && i < length; i++)
+    {
+        hash ^= data[i];
+        hash *= 0x100000001b3ULL;
+    }
+
+    return hash;
+}
+
+static int loadFrames(const char *path, std::vector<ReplayFrame> &frames)
+{
+    FILE *file = fopen(path, "r");
+    if (!file)
+    {
+        fprintf(stderr, "replay: failed to open baseline: %s\n", path);
+        return 0;
+    }
+
+    char line[256];
+    while (fgets(line, sizeof(line), file))
+    {
+        ReplayFrame frame = {};
+        unsigned long long hash;
+
+        if (line[0] != '#' && sscanf(line, "%ld %llx %lu %lu %d", &frame.frame, &hash, &frame.updateMicros, &frame.probeMicros, &frame.cellsPushed) >= 4)
+        {
+            frame.hash = hash;
+            frames.push_back(frame);
+        }
+    }
+
+    fclose(file);
+    return 1;
+}
+
+static double averageFrameMicros(const std::vector<ReplayFrame> &frames)
+{
+    double total = 0;
+    for (size_t i = 0; i < frames.size(); i++)
+    {
+        total += frames[i].updateMicros + frames[i].probeMicros;
+    }
+
+    return frames.empty() ? 0 : total / frames.size();
+}
+
+static unsigned long percentileFrameMicros(const std::vector<ReplayFrame> &frames, double percentile)
+{
+    if (frames.empty())
+    {
+        return 0;
+    }
+
+    std::vector<unsigned long> times;
+    for (size_t i = 0; i < frames.size(); i++)
+    {
+        times.push_back(frames[i].updateMicros + frames[i].probeMicros);
+    }
+    std::sort(times.begin(), times.end());
+
+    size_t index = (size_t)(percentile * (times.size() - 1));
+    return times[index];
+}
+
+static int setGamePath(const char *gameName)
+{
+    if (gameName[0] == '/')
+    {
+        snprintf(gameFilePath, sizeof(gameFilePath), "%s", gameName);
+    }
+    else
+    {
+        snprintf(gameFilePath, sizeof(gameFilePath), "/games/%s", gameName);
+    }
+
+    if (!LittleFS.exists(gameFilePath))
+    {
+        fprintf(stderr, "replay: game not found: %s\n", gameFilePath);
+        return 0;
+    }
+
+    return 1;
+}
+
+// play another game in the shared VM, then leave the clock and input as a cold run finds them
+static void warmUp(const std::vector<ReplayEvent> &events)
+{
+    duk_context *ctx = gameStart();
+    size_t nextEvent = 0;
+
+    for (long frame = 0; frame < REPLAY_WARM_UP_FRAMES && shouldContinue && !gameIsOver(ctx); frame++)
+    {
+        while (nextEvent < events.size() && events[nextEvent].frame <= frame)
+        {
+            applyButtons(events[nextEvent].buttons);
+            nextEvent++;
+        }
+
+        hostClockAdvance(REPLAY_FRAME_TIME);
+        gameUpdate(ctx);
+    }
+
+    gameEnd(ctx);
+    displayFlush();
+
+    applyButtons(0);
+    hostClockSetVirtual(false);
+    hostClockSetVirtual(true);
+}
+
+// run the loaded game until the script ends, it is over or frameLimit (if > 0) is reached;
+// each frame is written to out if given
+static void playFrames(duk_context *ctx, const std::vector<ReplayEvent> &events, long frameLimit, FILE *out,
+                       std::vector<ReplayFrame> &frames)
+{
+    size_t nextEvent = 0;
+    long frame = 0;
+    int isGameOver = 0;
+
+    while (shouldContinue && !isGameOver && (frameLimit <= 0 || frame < frameLimit))
+    {
+        int isEnd = 0;
+
+        while (nextEvent < events.size() && events[nextEvent].frame <= frame)
+        {
+            isEnd = isEnd || events[nextEvent].isEnd;
+            applyButtons(events[nextEvent].buttons);
+            nextEvent++;
+        }
+
+        if (isEnd)
+        {
+            break;
+        }
+
+        hostClockAdvance(REPLAY_FRAME_TIME);
+
+        unsigned long frameStart = micros();
+        gameUpdate(ctx);
+        unsigned long updateEnd = micros();
+        isGameOver = gameIsOver(ctx);
+        unsigned long probeEnd = micros();
+
+        // the frame's DMA transfer may still be running; hashing needs it finished
+        displayFlush();
+
+        ReplayFrame result = {frame, hashPanel(), updateEnd - frameStart, probeEnd - updateEnd, displayCellsPushed()};
+        frames.push_back(result);
+
+        if (out != NULL)
+        {
+            fprintf(out, "%ld %016llx %lu %lu %d\n", result.frame, (unsigned long long)result.hash, result.updateMicros, result.probeMicros, result.cellsPushed);
+        }
+
+        frame++;
+    }
+}
+
+// frames whose hash differs, over the frames both runs have
+static long countMismatches(const std::vector<ReplayFrame> &frames, const std::vector<ReplayFrame> &baseline, long *firstMismatch)
+{
+    size_t compareCount = std::min(frames.size(), baseline.size());
+    long mismatchCount = 0;
+
+    for (size_t i = 0; i < compareCount; i++)
+    {
+        if (frames[i].hash != baseline[i].hash)
+        {
+            if (*firstMismatch < 0)
+            {
+                *firstMismatch = frames[i].frame;
+            }
+            mismatchCount++;
+        }
+    }
+
+    return mismatchCount;
+}
+
+// play one game from the start, then leave the clock, input and random seed as setup() did
+static int playGame(const char *gameName, const std::vector<ReplayEvent> &events, long frameLimit, unsigned long seed,
+                    std::vector<ReplayFrame> &frames)
+{
+    if (!setGamePath(gameName))
+    {
+        return 0;
+    }
+
+    duk_context *ctx = gameStart();
+    playFrames(ctx, events, frameLimit, NULL, frames);
+    gameEnd(ctx);
+    displayFlush();
+
+    applyButtons(0);
+    hostClockSetVirtual(false);
+    hostClockSetVirtual(true);
+    randomSeed(seed);
+    return 1;
+}
+
+static int checkResetRun(const char *gameName, const char *afterName, const std::vector<ReplayFrame> &frames,
+                         const std::vector<ReplayFrame> &cold)
+{
+    long firstMismatch = -1;
+    long mismatchCount = countMismatches(frames, cold, &firstMismatch);
+
+    if (mismatchCount > 0 || frames.size() != cold.size())
+    {
+        fprintf(stderr, "replay: VISUAL REGRESSION: %s after %s: %ld frames differ (first at frame %ld), %zu frames ran, cold run %zu\n",
+                gameName, afterName, mismatchCount, firstMismatch, frames.size(), cold.size());
+        return 0;
+    }
+
+    fprintf(stderr, "replay: %s after %s matches its cold run (%zu frames)\n", gameName, afterName, frames.size());
+    return 1;
+}
+
+// other cold in a VM of its own, then game cold, other and game again in one shared VM
+static int resetCheck(const char *gameName, const char *otherName, const std::vector<ReplayEvent> &events,
+                      long frameLimit, unsigned long seed)
+{
+    std::vector<ReplayFrame> otherCold, gameCold, otherAfter, gameAfter;
+
+    hostOptions()->sharedVm = false;
+    setup();
+    gameCount = 1;
+    randomSeed(seed);
+
+    if (!playGame(otherName, events, frameLimit, seed, otherCold))
+    {
+        return 1;
+    }
+
+    hostOptions()->sharedVm = true;
+    if (!playGame(gameName, events, frameLimit, seed, gameCold) ||
+        !playGame(otherName, events, frameLimit, seed, otherAfter) ||
+        !playGame(gameName, events, frameLimit, seed, gameAfter))
+    {
+        return 1;
+    }
+
+    int isOtherMatch = checkResetRun(otherName, gameName, otherAfter, otherCold);
+    int isGameMatch = checkResetRun(gameName, otherName, gameAfter, gameCold);
+    return isOtherMatch && isGameMatch ? 0 : 2;
+}
+
+int hostMain(int argc, char **argv)
+{
+    // the other host-only tool: regenerating bytecode.h (see main.cpp)
+    const char *compilePath = argValue(argc, argv, "--compile-engine");
+    if (compilePath != NULL)
+    {
+        return hostCompileEngine(compilePath);
+    }
+
+    const char *gameName = argValue(argc, argv, "--replay");
+    if (gameName == NULL)
+    {
+        return -1;
+    }
+
+    const char *inputPath = argValue(argc, argv, "--input");
+    const char *outPath = argValue(argc, argv, "--out");
+    const char *baselinePath = argValue(argc, argv, "--baseline");
+    const char *toleranceStr = argValue(argc, argv, "--tolerance");
+    const char *seedStr = argValue(argc, argv, "--seed");
+    const char *warmUpName = argValue(argc, argv, "--warm-up");
+    const char *resetCheckName = argValue(argc, argv, "--reset-check");
+
+    double tolerance = toleranceStr ? atof(toleranceStr) : 0.25;
+
+    // the replay owns the frame limit; don't let hostFrameEnd() exit mid-run
+    long frameLimit = hostOptions()->frameLimit;
+    hostOptions()->frameLimit = 0;
+
+    std::vector<ReplayEvent> events;
+    if (inputPath && !loadInputScript(inputPath, events))
+    {
+        return 1;
+    }
+
+    int hasEnd = 0;
+    for (size_t i = 0; i < events.size(); i++)
+    {
+        hasEnd = hasEnd || events[i].isEnd;
+    }
+
+    if (frameLimit <= 0 && !hasEnd)
+    {
+        fprintf(stderr, "replay: no end frame; pass --frames or end the input script with '<frame> end'\n");
+        return 1;
+    }
+
+    unsigned long seed = seedStr ? strtoul(seedStr, NULL, 10) : 1;
+
+    if (resetCheckName != NULL)
+    {
+        hostClockSetVirtual(true);
+        return resetCheck(gameName, resetCheckName, events, frameLimit, seed);
+    }
+
+    FILE *out = outPath ? fopen(outPath, "w") : stdout;
+    if (!out)
+    {
+        fprintf(stderr, "replay: failed to open output: %s\n", outPath);
+        return 1;
+    }
+
+    // stdio would allocate the buffer on the first frame, inside the heap-used numbers
+    static char outBuffer[BUFSIZ];
+    setvbuf(out, outBuffer, _IOFBF, sizeof(outBuffer));
+
+    randomSeed(seed);
+    hostClockSetVirtual(true);
+
+    if (warmUpName != NULL)
+    {
+        hostOptions()->sharedVm = true;
+    }
+
+    setup();
+    gameCount = 1;
+
+    if (warmUpName != NULL)
+    {
+        if (!setGamePath(warmUpName))
+        {
+            return 1;
+        }
+        warmUp(events);
+    }
+
+    if (!setGamePath(gameName))
+    {
+        return 1;
+    }
+
+    // the frame records are taken before the game, so the heap after exit can be
+    // compared with the heap before load
+    std::vector<ReplayFrame> frames;
+    frames.reserve(frameLimit > 0 ? (size_t)frameLimit : events.empty() ? 0 : (size_t)events.back().frame + 1);
+    uint32_t heapBefore = heapUsed();
+
+    unsigned long startMicros = micros();
+    duk_context *ctx = gameStart();
+    unsigned long loadMicros = micros() - startMicros;
+    uint32_t loadHeap = vmHeapUsed(ctx);
+
+    fprintf(out, "# replay %s load_us %lu\n", gameFilePath, loadMicros);
+    fprintf(out, "# frame hash update_us probe_us cells\n");
+
+    playFrames(ctx, events, frameLimit, out, frames);
+    long frame = (long)frames.size();
+
+    gameEnd(ctx);
+    uint32_t heapAfter = heapUsed();
+
+    unsigned long totalMicros = micros() - startMicros;
+
+    if (out != stdout)
+    {
+        fclose(out);
+    }
+
+    long cellsPushed = 0;
+    for (size_t i = 0; i < frames.size(); i++)
+    {
+        cellsPushed += frames[i].cellsPushed;
+    }
+
+    fprintf(stderr, "replay: %ld frames (%.1f s of game time) in %.2f s, frame avg %.0f us, p99 %lu us, max %lu us, cells pushed avg %.1f\n",
+            frame, (frame * REPLAY_FRAME_TIME) / 1000.0, totalMicros / 1000000.0,
+            averageFrameMicros(frames), percentileFrameMicros(frames, 0.99), percentileFrameMicros(frames, 1.0),
+            frames.empty() ? 0.0 : (double)cellsPushed / frames.size());
+    // only taken after load: later on the harness's own per-frame records share the same heap
+    fprintf(stderr, "replay: vm heap %lu bytes after load\n", (unsigned long)loadHeap);
+    fprintf(stderr, "replay: heap used %lu bytes before load, %lu after exit\n", (unsigned long)heapBefore,
+            (unsigned long)heapAfter);
+
+    if (baselinePath == NULL)
+    {
+        return 0;
+    }
+
+    std::vector<ReplayFrame> baseline;
+    if (!loadFrames(baselinePath, baseline))
+    {
+        return 1;
+    }
+
+    long firstMismatch = -1;
+    long mismatchCount = countMismatches(frames, baseline, &firstMismatch);
+
+    if (mismatchCount > 0)
+    {
+        fprintf(stderr, "replay: VISUAL REGRESSION: %ld frames differ, first at frame %ld\n", mismatchCount, firstMismatch);
+        return 2;
+    }
+
+    // e.g. the game ended (or stopped ending) early: the frames that ran may all match
+    if (frames.size() != baseline.size())
+    {
+        fprintf(stderr, "replay: VISUAL REGRESSION: %zu frames ran, baseline has %zu\n", frames.size(), baseline.size());
+        return 2;
+    }
+
+    double average = averageFrameMicros(frames);
+    double baselineAverage = averageFrameMicros(baseline);
+
+    if (baselineAverage > 0 && average > baselineAverage * (1.0 + tolerance))
+    {
+        fprintf(stderr, "replay: TIMING REGRESSION: frame avg %.0f us vs baseline %.0f us (tolerance %.0f%%)\n",
+                average, baselineAverage, tolerance * 100.0);
+        return 3;
+    }
+
+    fprintf(stderr, "replay: matches baseline (frame avg %.0f us vs %.0f us)\n", average, baselineAverage);
+    return 0;
+}
+
+#endif
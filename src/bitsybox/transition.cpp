@@ -0,0 +1,177 @@
+#include <math.h>
+#include <string.h>
+#include "transition.h"
+
+#define TRANSITION_PIXELS (TRANSITION_SIZE * TRANSITION_SIZE)
+
+static const char *effectNames[] = {
+    "fade_w",
+    "fade_b",
+    "wave",
+    "tunnel",
+    "slide_u",
+    "slide_d",
+    "slide_l",
+    "slide_r",
+};
+
+TransitionEffect transitionFindEffect(const char *name)
+{
+    if (name == NULL)
+    {
+        return TRANSITION_NONE;
+    }
+
+    for (int i = 0; i < (int)(sizeof(effectNames) / sizeof(effectNames[0])); i++)
+    {
+        if (strcmp(name, effectNames[i]) == 0)
+        {
+            return (TransitionEffect)i;
+        }
+    }
+
+    return TRANSITION_NONE;
+}
+
+// the palette does the fading, the image just switches halfway
+static void drawFade(const TransitionImage &start, const TransitionImage &end, double delta, uint8_t *dst)
+{
+    memcpy(dst, delta < 0.5 ? start.pixels : end.pixels, TRANSITION_PIXELS);
+}
+
+// each row is the image rotated sideways by a sine of its y, so it is two copies
+static void drawWave(const TransitionImage &start, const TransitionImage &end, double delta, uint8_t *dst)
+{
+    double waveDelta = delta < 0.5 ? delta / 0.5 : 1 - ((delta - 0.5) / 0.5);
+    double size = 2 + (14 * waveDelta);
+    const uint8_t *src = delta < 0.5 ? start.pixels : end.pixels;
+
+    for (int y = 0; y < TRANSITION_SIZE; y++, src += TRANSITION_SIZE, dst += TRANSITION_SIZE)
+    {
+        double offset = y + (waveDelta * waveDelta * 0.2 * TRANSITION_SIZE);
+        int shift = (int)floor(sin(offset / 4) * size);
+
+        // dst[x] = src[(x + shift) wrapped]
+        shift = ((shift % TRANSITION_SIZE) + TRANSITION_SIZE) % TRANSITION_SIZE;
+        memcpy(dst, src + shift, TRANSITION_SIZE - shift);
+        memcpy(dst + (TRANSITION_SIZE - shift), src, shift);
+    }
+}
+
+// the start room closes to black around the player, then the end room opens
+static void drawTunnel(const TransitionImage &start, const TransitionImage &end, double delta, uint8_t *dst)
+{
+    if (delta > 0.4 && delta <= 0.6)
+    {
+        memset(dst, 0, TRANSITION_PIXELS);
+        return;
+    }
+
+    const TransitionImage &image = delta <= 0.4 ? start : end;
+    double tunnelDelta = delta <= 0.4 ? 1 - (delta / 0.4) : (delta - 0.6) / 0.4;
+    double radius = TRANSITION_SIZE * tunnelDelta;
+
+    // largest squared distance with sqrt(distance) <= radius, found with the same
+    // sqrt as the JS version so the edge lands on the same pixels
+    long limit = radius > 0 ? (long)(radius * radius) : -1;
+    while (limit >= 0 && sqrt((double)limit) > radius)
+    {
+        limit--;
+    }
+    while (sqrt((double)(limit + 1)) <= radius)
+    {
+        limit++;
+    }
+
+    const uint8_t *src = image.pixels;
+
+    for (int y = 0; y < TRANSITION_SIZE; y++)
+    {
+        int yDist = image.centerY - y;
+
+        for (int x = 0; x < TRANSITION_SIZE; x++, src++, dst++)
+        {
+            int xDist = image.centerX - x;
+            *dst = (xDist * xDist) + (yDist * yDist) > limit ? 0 : *src;
+        }
+    }
+}
+
+// the end room pushes the start room out; offset > 0 moves the view down / right
+static void drawSlideVertical(const TransitionImage &start, const TransitionImage &end, int offset, uint8_t *dst)
+{
+    for (int y = 0; y < TRANSITION_SIZE; y++, dst += TRANSITION_SIZE)
+    {
+        int srcY = y + offset;
+        const uint8_t *src = start.pixels;
+
+        if (srcY < 0)
+        {
+            srcY += TRANSITION_SIZE;
+            src = end.pixels;
+        }
+        else if (srcY >= TRANSITION_SIZE)
+        {
+            srcY -= TRANSITION_SIZE;
+            src = end.pixels;
+        }
+
+        memcpy(dst, src + (srcY * TRANSITION_SIZE), TRANSITION_SIZE);
+    }
+}
+
+static void drawSlideHorizontal(const TransitionImage &start, const TransitionImage &end, int offset, uint8_t *dst)
+{
+    for (int y = 0; y < TRANSITION_SIZE; y++, dst += TRANSITION_SIZE)
+    {
+        const uint8_t *startRow = start.pixels + (y * TRANSITION_SIZE);
+        const uint8_t *endRow = end.pixels + (y * TRANSITION_SIZE);
+
+        if (offset < 0)
+        {
+            // dst[x] = x >= -offset ? start[x + offset] : end[x + offset + size]
+            memcpy(dst, endRow + TRANSITION_SIZE + offset, -offset);
+            memcpy(dst - offset, startRow, TRANSITION_SIZE + offset);
+        }
+        else
+        {
+            // dst[x] = x < size - offset ? start[x + offset] : end[x + offset - size]
+            memcpy(dst, startRow + offset, TRANSITION_SIZE - offset);
+            memcpy(dst + TRANSITION_SIZE - offset, endRow, offset);
+        }
+    }
+}
+
+void transitionDraw(TransitionEffect effect, const TransitionImage &start, const TransitionImage &end, double delta,
+                    uint8_t *dst)
+{
+    int slideOffset = (int)floor(TRANSITION_SIZE * delta);
+
+    switch (effect)
+    {
+    case TRANSITION_FADE_W:
+    case TRANSITION_FADE_B:
+        drawFade(start, end, delta, dst);
+        break;
+    case TRANSITION_WAVE:
+        drawWave(start, end, delta, dst);
+        break;
+    case TRANSITION_TUNNEL:
+        drawTunnel(start, end, delta, dst);
+        break;
+    case TRANSITION_SLIDE_U:
+        drawSlideVertical(start, end, -slideOffset, dst);
+        break;
+    case TRANSITION_SLIDE_D:
+        drawSlideVertical(start, end, slideOffset, dst);
+        break;
+    case TRANSITION_SLIDE_L:
+        drawSlideHorizontal(start, end, -slideOffset, dst);
+        break;
+    case TRANSITION_SLIDE_R:
+        drawSlideHorizontal(start, end, slideOffset, dst);
+        break;
+    default:
+        break;
+    }
+}
@@ -0,0 +1,41 @@
+#ifndef TRANSITION_H
+#define TRANSITION_H
+
+#include <stdint.h>
+
+/*
+ * Native versions of the room transition effects registered in transition.js. Each
+ * kernel writes a whole frame of palette indices from the start and end room images
+ * (TRANSITION_SIZE x TRANSITION_SIZE indices each) for a delta between 0 and 1, so JS
+ * only picks the effect and the delta instead of calling back once per pixel.
+ */
+
+#define TRANSITION_SIZE 128
+
+typedef enum TransitionEffect
+{
+    TRANSITION_NONE = -1,
+    TRANSITION_FADE_W,
+    TRANSITION_FADE_B,
+    TRANSITION_WAVE,
+    TRANSITION_TUNNEL,
+    TRANSITION_SLIDE_U,
+    TRANSITION_SLIDE_D,
+    TRANSITION_SLIDE_L,
+    TRANSITION_SLIDE_R,
+} TransitionEffect;
+
+typedef struct TransitionImage
+{
+    const uint8_t *pixels;
+    int centerX; // player center in pixels, the tunnel closes / opens around it
+    int centerY;
+} TransitionImage;
+
+// effect registered under this name in transition.js, or TRANSITION_NONE
+TransitionEffect transitionFindEffect(const char *name);
+
+void transitionDraw(TransitionEffect effect, const TransitionImage &start, const TransitionImage &end, double delta,
+                    uint8_t *dst);
+
+#endif
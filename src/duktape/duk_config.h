@@ -3097,6 +3097,53 @@ typedef struct duk_hthread duk_context;
 
 /* __OVERRIDE_DEFINES__ */
 
+/* bitsybox low-memory profile (-DBITSYBOX_LOW_MEMORY, pio env esp32dev_lowmem):
+ * smaller per-string / per-object headers and heap tables, traded for some lookup
+ * speed, and built-in methods as lightfuncs (no own properties, so e.g. Math.floor.x
+ * can't be set). On the 64-bit host an empty heap drops from 101 KB to 49 KB, the
+ * boot menu from 1122368 to 1017328 bytes and the forest game from 1746768 to 1605408.
+ *
+ * Not included: ROM built-ins (DUK_USE_ROM_OBJECTS / DUK_USE_ROM_STRINGS), which
+ * would keep the built-in objects and their strings in flash instead of the 49 KB
+ * above. They need duktape.c and this file regenerated from the Duktape 2.6.0 dist,
+ *   python2 tools/configure.py --rom-support --rom-auto-lightfunc ...
+ * and this tree only carries the prepared sources (duktape.c #errors if they are
+ * defined). Adding them means vendoring the dist's tools/ and config/ and building
+ * the esp32dev_lowmem env from the regenerated sources.
+ *
+ * None of these change the bytecode dump format, so bytecode.h stays valid.
+ */
+#if defined(BITSYBOX_LOW_MEMORY)
+#undef DUK_USE_LITCACHE_SIZE                 /* 256 entry literal cache in every heap */
+#undef DUK_USE_STRTAB_MINSIZE
+#define DUK_USE_STRTAB_MINSIZE 128
+#define DUK_USE_STRHASH16
+#undef DUK_USE_HSTRING_ARRIDX                /* array index strings parsed when used */
+#define DUK_USE_OBJSIZES16                   /* at most 65535 properties / array items */
+#undef DUK_USE_HOBJECT_HASH_PROP_LIMIT
+#define DUK_USE_HOBJECT_HASH_PROP_LIMIT 32   /* only big objects get a hash part */
+#define DUK_USE_LIGHTFUNC_BUILTINS           /* built-in methods as lightfuncs, not function objects */
+#endif
+
+/* bitsybox: the frame profiler times every mark-and-sweep pass (profileGcBegin() and
+ * profileGcEnd() in profiler.cpp). Not a stock Duktape option: the two calls are
+ * patched into duk_heap_mark_and_sweep(), around the pass itself, so finalizers that
+ * run after it count as JS.
+ */
+#define DUK_USE_MARK_AND_SWEEP_HOOKS
+#if defined(DUK_COMPILING_DUKTAPE)
+#if defined(__cplusplus)
+extern "C" {
+#endif
+void profileGcBegin(void);
+void profileGcEnd(void);
+#if defined(__cplusplus)
+}
+#endif
+#define DUK_USE_MARK_AND_SWEEP_BEGIN() profileGcBegin()
+#define DUK_USE_MARK_AND_SWEEP_END() profileGcEnd()
+#endif
+
 /*
  *  Conditional includes
  */
@@ -14158,7 +14158,7 @@ static duk_uint8_t *duk__dump_func(duk_hthread *thr, duk_hcompfunc *func, duk_bu
 		DUK_ASSERT((duk_size_t) (p_end - p) >= (duk_size_t) (n)); \
 	} while (0)
 
-static const duk_uint8_t *duk__load_func(duk_hthread *thr, const duk_uint8_t *p, const duk_uint8_t *p_end) {
+static const duk_uint8_t *duk__load_func(duk_hthread *thr, const duk_uint8_t *p, const duk_uint8_t *p_end, duk_bool_t is_template) {
 	duk_hcompfunc *h_fun;
 	duk_hbuffer *h_data;
 	duk_size_t data_size;
@@ -14295,7 +14295,7 @@ static const duk_uint8_t *duk__load_func(duk_hthread *thr, const duk_uint8_t *p,
 
 	/* Load inner functions to value stack, but don't yet copy to buffer. */
 	for (n = count_funcs; n > 0; n--) {
-		p = duk__load_func(thr, p, p_end);
+		p = duk__load_func(thr, p, p_end, 1);
 		if (p == NULL) {
 			goto format_error;
 		}
@@ -14348,17 +14348,23 @@ static const duk_uint8_t *duk__load_func(duk_hthread *thr, const duk_uint8_t *p,
 	DUK_DDD(DUK_DDDPRINT("function is reachable, reset top; func: %!iT", duk_get_tval(thr, idx_base)));
 	duk_set_top(thr, idx_base + 1);
 
-	/* Setup function properties. */
+	/* Setup function properties.  bitsybox: inner functions are loaded as
+	 * templates, like the compiler leaves them: duk_js_push_closure() gives
+	 * each closure its own .length, .prototype and name binding, so the
+	 * template gets none of them.
+	 */
 	tmp32 = DUK_RAW_READINC_U32_BE(p);
-	duk_push_u32(thr, tmp32);
-	duk_xdef_prop_stridx_short(thr, -2, DUK_STRIDX_LENGTH, DUK_PROPDESC_FLAGS_C);
+	if (!is_template) {
+		duk_push_u32(thr, tmp32);
+		duk_xdef_prop_stridx_short(thr, -2, DUK_STRIDX_LENGTH, DUK_PROPDESC_FLAGS_C);
+	}
 
 #if defined(DUK_USE_FUNC_NAME_PROPERTY)
 	p = duk__load_string_raw(thr, p);  /* -> [ func funcname ] */
 	func_env = thr->builtins[DUK_BIDX_GLOBAL_ENV];
 	DUK_ASSERT(func_env != NULL);
 	need_pop = 0;
-	if (DUK_HOBJECT_HAS_NAMEBINDING((duk_hobject *) h_fun)) {
+	if (DUK_HOBJECT_HAS_NAMEBINDING((duk_hobject *) h_fun) && !is_template) {
 		/* Original function instance/template had NAMEBINDING.
 		 * Must create a lexical environment on loading to allow
 		 * recursive functions like 'function foo() { foo(); }'.
@@ -14395,7 +14401,12 @@ static const duk_uint8_t *duk__load_func(duk_hthread *thr, const duk_uint8_t *p,
 	if (need_pop) {
 		duk_pop(thr);
 	}
-	duk_xdef_prop_stridx_short(thr, -2, DUK_STRIDX_NAME, DUK_PROPDESC_FLAGS_C);
+	if (is_template && duk_get_length(thr, -1) == 0) {
+		/* Anonymous: no template .name, so the closure inherits one. */
+		duk_pop(thr);
+	} else {
+		duk_xdef_prop_stridx_short(thr, -2, DUK_STRIDX_NAME, DUK_PROPDESC_FLAGS_C);
+	}
 #endif  /* DUK_USE_FUNC_NAME_PROPERTY */
 
 #if defined(DUK_USE_FUNC_FILENAME_PROPERTY)
@@ -14403,7 +14414,7 @@ static const duk_uint8_t *duk__load_func(duk_hthread *thr, const duk_uint8_t *p,
 	duk_xdef_prop_stridx_short(thr, -2, DUK_STRIDX_FILE_NAME, DUK_PROPDESC_FLAGS_C);
 #endif  /* DUK_USE_FUNC_FILENAME_PROPERTY */
 
-	if (DUK_HOBJECT_HAS_CONSTRUCTABLE((duk_hobject *) h_fun)) {
+	if (DUK_HOBJECT_HAS_CONSTRUCTABLE((duk_hobject *) h_fun) && !is_template) {
 		/* Restore empty external .prototype only for constructable
 		 * functions.  The prototype object should inherit from
 		 * Object.prototype.
@@ -14433,8 +14444,15 @@ static const duk_uint8_t *duk__load_func(duk_hthread *thr, const duk_uint8_t *p,
 		duk_push_u32(thr, tmp32);
 		duk_put_prop(thr, -3);
 	}
-	duk_compact_m1(thr);
-	duk_xdef_prop_stridx_short(thr, -2, DUK_STRIDX_INT_VARMAP, DUK_PROPDESC_FLAGS_NONE);
+	if (DUK_HOBJECT_GET_ENEXT(duk_known_hobject(thr, -1)) == 0) {
+		/* bitsybox: a function dumped without _Varmap gets an empty
+		 * one here; like the compiler, don't add an empty one.
+		 */
+		duk_pop(thr);
+	} else {
+		duk_compact_m1(thr);
+		duk_xdef_prop_stridx_short(thr, -2, DUK_STRIDX_INT_VARMAP, DUK_PROPDESC_FLAGS_NONE);
+	}
 
 	/* _Formals may have been missing in the original function, which is
 	 * handled using a marker length.
@@ -14452,6 +14470,9 @@ static const duk_uint8_t *duk__load_func(duk_hthread *thr, const duk_uint8_t *p,
 		DUK_DD(DUK_DDPRINT("no _Formals in dumped function"));
 	}
 
+	/* bitsybox: compact like the compiler and duk_js_push_closure() do. */
+	duk_compact_m1(thr);
+
 	/* Return with final function pushed on stack top. */
 	DUK_DD(DUK_DDPRINT("final loaded function: %!iT", duk_get_tval(thr, -1)));
 	DUK_ASSERT_TOP(thr, idx_base + 1);
@@ -14517,7 +14538,7 @@ DUK_EXTERNAL void duk_load_function(duk_hthread *thr) {
 	}
 	p++;
 
-	p = duk__load_func(thr, p, p_end);
+	p = duk__load_func(thr, p, p_end, 0);
 	if (p == NULL) {
 		goto format_error;
 	}
@@ -52439,6 +52460,9 @@ DUK_INTERNAL void duk_heap_mark_and_sweep(duk_heap *heap, duk_small_uint_t flags
 
 	DUK_ASSERT(heap->ms_prevent_count == 0);
 	DUK_ASSERT(heap->ms_running == 0);
+#if defined(DUK_USE_MARK_AND_SWEEP_HOOKS)
+	DUK_USE_MARK_AND_SWEEP_BEGIN();
+#endif
 	heap->ms_prevent_count = 1;
 	heap->ms_running = 1;
 	entry_creating_error = heap->creating_error;
@@ -52574,6 +52598,9 @@ DUK_INTERNAL void duk_heap_mark_and_sweep(duk_heap *heap, duk_small_uint_t flags
 	heap->ms_prevent_count = 0;
 	heap->ms_running = 0;
 	heap->creating_error = entry_creating_error;  /* for nested error handling, see GH-2278 */
+#if defined(DUK_USE_MARK_AND_SWEEP_HOOKS)
+	DUK_USE_MARK_AND_SWEEP_END();
+#endif
 
 	/*
 	 *  Assertions after
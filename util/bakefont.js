@@ -0,0 +1,176 @@
+var fs = require('fs');
+
+// usage: node util/bakefont.js src/bitsy/font src/bitsybox
+// bakes every .bitsyfont in the source directory into packed bitmap tables (see bakedfont.h)
+
+var args = process.argv.slice(2); // remove the node args
+var srcPath = args[0];
+var destPath = args[1];
+
+console.log("=== bake fonts: " + srcPath + " -> " + destPath + " ===");
+
+var srcPathSplit = srcPath.split("/");
+var bakeName = srcPathSplit[srcPathSplit.length - 1];
+var bakeHeaderFileName = bakeName + ".h";
+var bakeDef = bakeName.toUpperCase() + "_H";
+
+// same rules as Font.parseFont() in font.js
+function parseFont(fontData) {
+	var font = {
+		name: "unknown",
+		width: 6,
+		height: 8,
+		chars: {},
+	};
+
+	var lines = fontData.split(/\r?\n/);
+
+	var isReadingChar = false;
+	var isReadingCharProperties = false;
+	var curCharLineCount = 0;
+	var curChar = null;
+
+	for (var i = 0; i < lines.length; i++) {
+		var line = lines[i];
+
+		if (line[0] === "#") {
+			continue; // skip comment lines
+		}
+
+		if (!isReadingChar) {
+			var args = line.split(" ");
+			if (args[0] == "FONT") {
+				font.name = args[1];
+			}
+			else if (args[0] == "SIZE") {
+				font.width = parseInt(args[1]);
+				font.height = parseInt(args[2]);
+			}
+			else if (args[0] == "CHAR") {
+				isReadingChar = true;
+				isReadingCharProperties = true;
+
+				curCharLineCount = 0;
+				curChar = {
+					code: parseInt(args[1]),
+					width: font.width,
+					height: font.height,
+					offsetX: 0,
+					offsetY: 0,
+					spacing: font.width,
+					data: [],
+				};
+				font.chars[curChar.code] = curChar;
+			}
+		}
+		else {
+			if (isReadingCharProperties) {
+				var args = line.split(" ");
+				if (args[0].indexOf("CHAR_") == 0) {
+					if (args[0] == "CHAR_SIZE") {
+						curChar.width = parseInt(args[1]);
+						curChar.height = parseInt(args[2]);
+						curChar.spacing = parseInt(args[1]);
+					}
+					else if (args[0] == "CHAR_OFFSET") {
+						curChar.offsetX = parseInt(args[1]);
+						curChar.offsetY = parseInt(args[2]);
+					}
+					else if (args[0] == "CHAR_SPACING") {
+						curChar.spacing = parseInt(args[1]);
+					}
+				}
+				else {
+					isReadingCharProperties = false;
+				}
+			}
+
+			if (!isReadingCharProperties) {
+				for (var j = 0; j < curChar.width; j++) {
+					curChar.data.push(parseInt(line[j]));
+				}
+
+				curCharLineCount++;
+				if (curCharLineCount >= font.height) {
+					isReadingChar = false;
+				}
+			}
+		}
+	}
+
+	return font;
+}
+
+// 1-bit rows of ceil(width / 8) bytes, leftmost pixel in the high bit
+function packChar(c) {
+	var stride = Math.ceil(c.width / 8);
+	var bytes = [];
+
+	for (var y = 0; y < c.height; y++) {
+		for (var b = 0; b < stride; b++) {
+			var byte = 0;
+			for (var x = b * 8; x < Math.min((b + 1) * 8, c.width); x++) {
+				if (c.data[(y * c.width) + x] === 1) {
+					byte |= 0x80 >> (x - (b * 8));
+				}
+			}
+			bytes.push(byte);
+		}
+	}
+
+	return bytes;
+}
+
+function formatBytes(bytes) {
+	var str = "";
+	for (var i = 0; i < bytes.length; i += 16) {
+		str += "\t" + bytes.slice(i, i + 16).map(function(b) { return "0x" + ("0" + b.toString(16)).slice(-2); }).join(", ") + ",\n";
+	}
+	return str;
+}
+
+var bakeHeaderStr = "";
+bakeHeaderStr += "#ifndef " + bakeDef + "\n#define " + bakeDef + "\n\n";
+bakeHeaderStr += "// generated by util/bakefont.js from " + srcPath + "\n\n";
+bakeHeaderStr += "#include \"bakedfont.h\"\n\n";
+
+var fontTableStr = "";
+
+var files = fs.readdirSync(srcPath).sort();
+for (var i = 0; i < files.length; i++) {
+	var fileName = files[i];
+	var fileExt = fileName.split(".")[1];
+
+	if (fileExt !== "bitsyfont") {
+		continue;
+	}
+
+	console.log(fileName);
+
+	var font = parseFont(fs.readFileSync(srcPath + "/" + fileName, "utf8"));
+	var tableName = fileName.split(".")[0].replace(/[^A-Za-z0-9_]/g, "_");
+	var codes = Object.keys(font.chars).map(Number).sort(function(a, b) { return a - b; });
+
+	var charStr = "";
+	var bits = [];
+	for (var j = 0; j < codes.length; j++) {
+		var c = font.chars[codes[j]];
+		charStr += "\t{" + [c.code, c.width, c.height, c.offsetX, c.offsetY, c.spacing, bits.length].join(", ") + "},\n";
+		bits = bits.concat(packChar(c));
+	}
+
+	bakeHeaderStr += "// " + fileName + "\n";
+	bakeHeaderStr += "static constexpr BakedFontChar " + tableName + "_chars[] = {\n" + charStr + "};\n\n";
+	bakeHeaderStr += "static constexpr uint8_t " + tableName + "_bits[] = {\n" + formatBytes(bits) + "};\n\n";
+
+	// fonts are looked up by their file name, as FontManager does
+	fontTableStr += "\t{\"" + fileName.split(".")[0] + "\", " + font.width + ", " + font.height + ", " +
+		tableName + "_chars, " + codes.length + ", " + tableName + "_bits},\n";
+}
+
+bakeHeaderStr += "static constexpr BakedFont bakedFonts[] = {\n" + fontTableStr + "};\n\n";
+bakeHeaderStr += "#endif";
+
+fs.writeFileSync(destPath + "/" + bakeHeaderFileName, bakeHeaderStr);
+
+console.log("=== done! ===");